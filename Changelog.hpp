@@ -7,6 +7,45 @@
 
 @tableofcontents{html,latex}
 
+@section next_release Next release
+
+<h3>Changes to data types</h3>
+
+<ul>
+<li>iterator: Optimize read-only unaligned vector iterators for 256b and 512b vectors on AIE-ML and XDNA 2</li>
+<li>memory: Add gather and scatter driven by index vectors</li>
+<li>streams: Add make_circular_tensor_buffer_stream for circular buffers</li>
+<li>streams: Support tensor descriptors and tensor_buffer_stream on AIE</li>
+<li>sync: Support several readers or writers in producer_sem and consumer_sem on AIE-ML and XDNA 2</li>
+<li>sync: Behaviour change: buffered_input and buffered_output with several readers or writers now take semaphores of matching counts</li>
+<li>sync: Add acquire_next to buffered_input and buffered_output on AIE-ML and XDNA 2</li>
+<li>sync: Add deferred locking to scoped locks</li>
+</ul>
+
+<h3>Changes to operations</h3>
+
+<ul>
+<li>cic: Add CIC decimation and interpolation filters</li>
+<li>correlation: Add xcorr and autocorr kernels with peak detection</li>
+<li>spectral: Add Goertzel and sliding DFT kernels</li>
+<li>ddc: Add digital down-converter kernel</li>
+<li>scan: Add inclusive_scan and exclusive_scan for vectors, accumulators and buffers</li>
+<li>elementary: Add vectorized sin, cos, sincos and sincos_complex on AIE-ML and XDNA 2</li>
+<li>elementary: Behaviour change on AIE: int16 inputs of vector sin, cos, sincos and sincos_complex are now Q1.15 instead of Q1.31</li>
+<li>lut: Add make_lut to build lookup tables from a function</li>
+<li>activation: Add sigmoid, gelu, silu, softplus, exp, log and reciprocal activations for int8, int16 and bfloat16</li>
+<li>softmax: Add softmax kernel for float, bfloat16 and int8</li>
+<li>norm: Add single-pass layer_norm and rms_norm kernels</li>
+<li>div: Add exact vector division for int16 and int32 on AIE-ML and XDNA 2</li>
+<li>elementary: Add vectorized atan2, and arg and abs for complex vectors on AIE-ML and XDNA 2</li>
+<li>reduce: Add reduce_argmax and reduce_argmin for vectors and buffers</li>
+<li>reduce: Add top_k for vectors and buffers</li>
+<li>sort: Add bitonic sort for vectors and merge sort for buffers</li>
+<li>layout: Add transpose_matrix for row-major matrices</li>
+<li>layout: Add tile_matrix and untile_matrix for mmul tiled layouts</li>
+<li>conversion: Add pack_buffer and unpack_buffer, including dequantization with per-group scales</li>
+</ul>
+
 @section jan_2025 January 2025
 
 <h3>Global AIE API changes</h3>
@@ -0,0 +1,503 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2025 Advanced Micro Devices, Inc.
+
+/**
+ * @file
+ * @brief Vectorized activation functions based on linear approximation.
+ */
+
+#pragma once
+
+#ifndef __AIE_API_ACTIVATION__HPP__
+#define __AIE_API_ACTIVATION__HPP__
+
+#include <limits>
+
+#include "aie.hpp"
+
+namespace aie::detail {
+
+enum class activation_op {
+    sigmoid,
+    gelu,
+    silu,
+    softplus,
+    exp,
+    log,
+    reciprocal
+};
+
+// Double precision math that can be evaluated in constant expressions, so activation tables are generated at compile
+// time
+
+static constexpr double activation_ln2 = 0.693147180559945309;
+
+constexpr double activation_pow2(int e)
+{
+    double ret = 1.0;
+
+    for (int i = 0; i < e; ++i)
+        ret *= 2.0;
+    for (int i = 0; i > e; --i)
+        ret *= 0.5;
+
+    return ret;
+}
+
+constexpr double activation_exp(double x)
+{
+    if (x > 709.0)
+        return std::numeric_limits<double>::infinity();
+    if (x < -745.0)
+        return 0.0;
+
+    // exp(x) = 2^n * exp(r), with |r| <= ln(2) / 2
+    const int    n = int(x / activation_ln2 + (x < 0? -0.5 : 0.5));
+    const double r = x - n * activation_ln2;
+
+    double term = 1.0, sum = 1.0;
+
+    for (unsigned k = 1; k < 20; ++k) {
+        term *= r / k;
+        sum  += term;
+    }
+
+    return sum * activation_pow2(n);
+}
+
+constexpr double activation_log(double x)
+{
+    if (x <= 0.0)
+        return -std::numeric_limits<double>::infinity();
+    if (x == std::numeric_limits<double>::infinity())
+        return x;
+
+    int e = 0;
+
+    for (; x >= 2.0; ++e)
+        x *= 0.5;
+    for (; x < 1.0; --e)
+        x *= 2.0;
+
+    // log(m) = 2 * atanh((m - 1) / (m + 1)) for m in [1, 2)
+    const double z  = (x - 1.0) / (x + 1.0);
+    const double z2 = z * z;
+
+    double term = z, sum = 0.0;
+
+    for (unsigned k = 1; k < 40; k += 2) {
+        sum  += term / k;
+        term *= z2;
+    }
+
+    return 2.0 * sum + e * activation_ln2;
+}
+
+// Abramowitz and Stegun 7.1.26, with an absolute error below 1.5e-7
+constexpr double activation_erf(double x)
+{
+    const double a = x < 0? -x : x;
+    const double t = 1.0 / (1.0 + 0.3275911 * a);
+    const double p = t * (0.254829592 + t * (-0.284496736 + t * (1.421413741 + t * (-1.453152027 + t * 1.061405429))));
+    const double y = 1.0 - p * activation_exp(-a * a);
+
+    return x < 0? -y : y;
+}
+
+template <activation_op Op>
+constexpr double activation_func(double x)
+{
+    if constexpr (Op == activation_op::sigmoid)
+        return 1.0 / (1.0 + activation_exp(-x));
+    else if constexpr (Op == activation_op::gelu)
+        return 0.5 * x * (1.0 + activation_erf(x * 0.707106781186547524));
+    else if constexpr (Op == activation_op::silu)
+        return x / (1.0 + activation_exp(-x));
+    else if constexpr (Op == activation_op::softplus)
+        return x > 40.0? x : activation_log(1.0 + activation_exp(x));
+    else if constexpr (Op == activation_op::exp)
+        return activation_exp(x);
+    else if constexpr (Op == activation_op::log)
+        return activation_log(x);
+    else if constexpr (Op == activation_op::reciprocal)
+        return x == 0.0? std::numeric_limits<double>::infinity() : 1.0 / x;
+}
+
+template <typename T>
+struct activation_fixed_traits;
+
+template <>
+struct activation_fixed_traits<int8>
+{
+    using lut_value_type = int8;
+
+    // Minimum number of step bits supported by linear_approx for int8 inputs
+    static constexpr unsigned step_bits        = 2;
+    static constexpr unsigned lanes            = 32;
+    static constexpr int      max_shift_offset = 16;
+    static constexpr int      frac_bits        = 4;
+};
+
+template <>
+struct activation_fixed_traits<int16>
+{
+    using lut_value_type = int32;
+
+    static constexpr unsigned step_bits        = 9;
+    static constexpr unsigned lanes            = 16;
+    static constexpr int      max_shift_offset = 24;
+    static constexpr int      frac_bits        = 11;
+};
+
+// Function evaluated on raw fixed-point input values, returning raw fixed-point output values saturated to the range of
+// the output type
+template <activation_op Op, typename T, int InFracBits, int OutFracBits>
+struct activation_fixed_func
+{
+    constexpr double operator()(double q) const
+    {
+        constexpr double lo = double(std::numeric_limits<T>::min());
+        constexpr double hi = double(std::numeric_limits<T>::max());
+
+        const double y = activation_func<Op>(q / activation_pow2(InFracBits)) * activation_pow2(OutFracBits);
+
+        return y < lo? lo : (y > hi? hi : y);
+    }
+};
+
+// Returns the largest offset shift for which all the slopes of the table are representable in the LUT value type
+template <typename LutT, unsigned Elems, typename Fn>
+constexpr int activation_shift_offset(const Fn &func, double first, double last, unsigned step_bits, int max_shift)
+{
+    const double width = (last - first) / Elems;
+
+    double max_slope = 0.0;
+
+    for (unsigned i = 0; i < Elems; ++i) {
+        const double x0 = first + i * width;
+        const double s  = (func(x0 + width) - func(x0)) / activation_pow2(step_bits);
+
+        const double a  = s < 0? -s : s;
+
+        max_slope = a > max_slope? a : max_slope;
+    }
+
+    int shift = 0;
+
+    while (shift < max_shift && max_slope * activation_pow2(shift + 1) <= double(std::numeric_limits<LutT>::max()))
+        ++shift;
+
+    return shift;
+}
+
+template <activation_op Op, typename T, int InFracBits, int OutFracBits>
+class activation_fixed
+{
+    using traits         = activation_fixed_traits<T>;
+    using lut_value_type = typename traits::lut_value_type;
+    using lut_type       = aie::lut<4, lut_value_type, lut_value_type>;
+
+    // The table covers the whole input range, so no range reduction is needed and out of range outputs are saturated
+    // when the table is generated
+    static constexpr unsigned elems = 1u << (type_bits_v<T> - traits::step_bits);
+    static constexpr double   first = -activation_pow2(type_bits_v<T> - 1);
+    static constexpr double   last  =  activation_pow2(type_bits_v<T> - 1);
+
+    static constexpr activation_fixed_func<Op, T, InFracBits, OutFracBits> func{};
+
+    static constexpr int shift_offset = activation_shift_offset<lut_value_type, elems>(func, first, last, traits::step_bits,
+                                                                                      traits::max_shift_offset);
+
+    static constexpr auto lut_ab_ = make_linear_approx_lut<4, lut_value_type, lut_value_type, elems>(func, first, last,
+                                                                                                    traits::step_bits,
+                                                                                                    shift_offset);
+    static constexpr auto lut_cd_ = lut_ab_;
+
+public:
+    static constexpr unsigned lanes = traits::lanes;
+
+    activation_fixed() :
+        lut_(elems, lut_ab_.data(), lut_cd_.data()),
+        approx_(lut_, traits::step_bits, elems / 2, shift_offset)
+    {}
+
+    __aie_inline
+    vector<T, lanes> run(const vector<T, lanes> &v)
+    {
+        return approx_.compute(v).template to_vector<T>(shift_offset);
+    }
+
+private:
+    lut_type                        lut_;
+    aie::linear_approx<T, lut_type> approx_;
+};
+
+// Floating-point linear approximation indexes the table with the integer part of the input, so inputs are scaled by a
+// power of two before the lookup to obtain segments narrower than one
+template <activation_op Op>
+struct activation_bfloat16_traits
+{
+    // x in [-8, 8) in steps of 1/8
+    static constexpr double   scale = 8.0;
+    static constexpr double   first = -64.0;
+    static constexpr double   last  =  64.0;
+    static constexpr unsigned elems = 128;
+    static constexpr int      bias  = 64;
+
+    static constexpr double func(double y)
+    {
+        return activation_func<Op>(y / scale);
+    }
+};
+
+template <>
+struct activation_bfloat16_traits<activation_op::exp>
+{
+    // 2^f for f in [0, 1) in steps of 1/32
+    static constexpr double   scale = 32.0;
+    static constexpr double   first = 0.0;
+    static constexpr double   last  = 32.0;
+    static constexpr unsigned elems = 32;
+    static constexpr int      bias  = 0;
+
+    static constexpr double func(double y)
+    {
+        return activation_exp(y / scale * activation_ln2);
+    }
+};
+
+template <>
+struct activation_bfloat16_traits<activation_op::log>
+{
+    // log(m) for m in [1, 2) in steps of 1/32
+    static constexpr double   scale = 32.0;
+    static constexpr double   first = 32.0;
+    static constexpr double   last  = 64.0;
+    static constexpr unsigned elems = 32;
+    static constexpr int      bias  = -32;
+
+    static constexpr double func(double y)
+    {
+        return activation_log(y / scale);
+    }
+};
+
+template <activation_op Op>
+class activation_bfloat16
+{
+    using traits   = activation_bfloat16_traits<Op>;
+    using lut_type = aie::lut<4, float, bfloat16>;
+
+    static constexpr auto lut_ab_ = make_linear_approx_lut<4, float, bfloat16, traits::elems>(traits::func, traits::first,
+                                                                                             traits::last, 0, 0);
+    static constexpr auto lut_cd_ = lut_ab_;
+
+public:
+    static constexpr unsigned lanes = 16;
+
+    activation_bfloat16() :
+        lut_(traits::elems, lut_ab_.data(), lut_cd_.data()),
+        approx_(lut_, 0, traits::bias)
+    {}
+
+    __aie_inline
+    vector<bfloat16, lanes> run(const vector<bfloat16, lanes> &v)
+    {
+        if constexpr (Op == activation_op::exp) {
+            // exp(x) = 2^n * 2^f, with n = floor(x * log2(e)) and f in [0, 1). The reduction is done in float so the
+            // fractional part keeps its precision for large inputs. n is adjusted after the conversion so the result
+            // does not depend on the rounding mode.
+            const vector<float, lanes> xf = aie::mul(v, bfloat16(1.0f)).template to_vector<float>();
+
+            vector<float, lanes> y = aie::mul(xf, 1.44269504f).template to_vector<float>();
+            y = aie::min(aie::max(y, -126.0f), 127.99f);
+
+            vector<int32, lanes> n = aie::to_fixed<int32>(y, 0);
+            vector<float, lanes> f = aie::sub(y, aie::to_float<float>(n, 0));
+
+            const mask<lanes> m = aie::lt(f, 0.0f);
+            n = aie::select(n, aie::sub(n, 1), m);
+            f = aie::select(f, aie::add(f, 1.0f), m);
+
+            const vector<bfloat16, lanes> t = aie::mul(f, float(traits::scale)).template to_vector<bfloat16>();
+            const vector<float, lanes>    p = approx_.compute(t).template to_vector<float>();
+
+            // 2^n is built directly from its exponent bits
+            const vector<float, lanes> scale = aie::upshift(aie::add(n, 127), 23).template cast_to<float>();
+
+            return aie::mul(p, scale).template to_vector<bfloat16>();
+        }
+        else if constexpr (Op == activation_op::log) {
+            // log(x) = e * log(2) + log(m), where the mantissa is extracted with an exponent that directly yields m * 32
+            const vector<int16, lanes> bits = v.template cast_to<int16>();
+            const vector<int16, lanes> e    = aie::sub(aie::downshift(bits, 7), int16(127));
+
+            const vector<bfloat16, lanes> m = aie::bit_or(int16((127 + 5) << 7),
+                                                          aie::bit_and(int16(0x7f), bits)).template cast_to<bfloat16>();
+
+            accum<accfloat, lanes> acc = approx_.compute(m);
+            acc = aie::mac(acc, aie::to_float<float>(e, 0), float(activation_ln2));
+
+            // Non-positive inputs return -inf
+            const vector<bfloat16, lanes> minus_inf = aie::broadcast<int16, lanes>(int16(0xff80)).template cast_to<bfloat16>();
+
+            return aie::select(acc.template to_vector<bfloat16>(), minus_inf, aie::le(v, bfloat16(0.0f)));
+        }
+        else {
+            // The table covers [-8, 8). Inputs are clamped to that range, and functions that tend to the identity for
+            // large inputs return the input beyond it.
+            const vector<bfloat16, lanes> xc = aie::min(aie::max(v, bfloat16(-8.0f)), bfloat16(7.96875f));
+            const vector<bfloat16, lanes> t  = aie::mul(xc, bfloat16(float(traits::scale))).template to_vector<bfloat16>();
+            const vector<bfloat16, lanes> r  = approx_.compute(t).template to_vector<bfloat16>();
+
+            if constexpr (Op == activation_op::sigmoid)
+                return r;
+            else
+                return aie::select(r, v, aie::ge(v, bfloat16(8.0f)));
+        }
+    }
+
+private:
+    lut_type                               lut_;
+    aie::linear_approx<bfloat16, lut_type> approx_;
+};
+
+// bfloat16 reciprocals use the existing vectorized implementation
+template <activation_op Op> requires(Op == activation_op::reciprocal)
+class activation_bfloat16<Op>
+{
+public:
+    static constexpr unsigned lanes = 16;
+
+    __aie_inline
+    vector<bfloat16, lanes> run(const vector<bfloat16, lanes> &v)
+    {
+        return aie::inv(v);
+    }
+};
+
+template <typename T>
+constexpr int activation_default_frac_bits()
+{
+    if constexpr (std::is_same_v<T, bfloat16>)
+        return 0;
+    else
+        return activation_fixed_traits<T>::frac_bits;
+}
+
+template <typename T>
+static constexpr int activation_default_frac_bits_v = activation_default_frac_bits<T>();
+
+} // namespace aie::detail
+
+namespace aie {
+
+using detail::activation_op;
+
+/**
+ * @ingroup group_nn
+ *
+ * Vectorized activation function. Non-linear functions are evaluated with @ref linear_approx, using slope/offset tables
+ * that are generated at compile time with the same fitting as @ref make_lut and stored once per instantiation.
+ *
+ * <table>
+ * <caption>Supported functions</caption>
+ * <tr><th>Operation<th>Function
+ * <tr><td>sigmoid    <td>1 / (1 + exp(-x))
+ * <tr><td>gelu       <td>x * (1 + erf(x / sqrt(2))) / 2
+ * <tr><td>silu       <td>x / (1 + exp(-x))
+ * <tr><td>softplus   <td>log(1 + exp(x))
+ * <tr><td>exp        <td>exp(x)
+ * <tr><td>log        <td>log(x)
+ * <tr><td>reciprocal <td>1 / x
+ * </table>
+ *
+ * For int8 and int16 the inputs and outputs are fixed-point values with InFracBits and OutFracBits fractional bits. The
+ * table spans the whole input range (64 segments for int8, 128 for int16), and function values that are not
+ * representable in the output format are saturated when the table is generated. For int16 the slope/offset pairs are
+ * stored as int32 values. Uniform segments cannot follow functions with a large dynamic range: exp, log and reciprocal
+ * have their largest errors where they are steep, and log and reciprocal are approximated linearly across the segment
+ * that contains zero. bfloat16 should be preferred for those functions.
+ *
+ * For bfloat16, sigmoid, gelu, silu and softplus use a table over [-8, 8) with segments of 1/8. Inputs are clamped to
+ * that range, and gelu, silu and softplus return the input beyond it. exp and log use range reduction: the input is
+ * split into a power of two and a value in [1, 2) that indexes a 32 segment table, so the relative error stays close
+ * to the bfloat16 precision over the whole range. exp saturates for inputs beyond 88. log returns -inf for non-positive
+ * inputs. reciprocal uses @ref inv.
+ *
+ * @code
+ * aie::activation<aie::activation_op::gelu, int16, 11, 11> gelu;  // Q4.11 input and output
+ *
+ * gelu.run(in, 1024, out);
+ * @endcode
+ *
+ * \note
+ * Objects keep internal pointers to their state, so they cannot be copied.
+ *
+ * @tparam Op          Activation function.
+ * @tparam T           Type of the input and output values. Must be int8, int16 or bfloat16.
+ * @tparam InFracBits  Number of fractional bits of fixed-point inputs. Ignored for bfloat16.
+ * @tparam OutFracBits Number of fractional bits of fixed-point outputs. Ignored for bfloat16.
+ */
+template <activation_op Op, typename T, int InFracBits = detail::activation_default_frac_bits_v<T>, int OutFracBits = InFracBits>
+    requires(arch::is(arch::Gen2) && Utils::is_one_of_v<T, int8, int16, bfloat16>)
+class activation
+{
+    using impl_type = std::conditional_t<std::is_same_v<T, bfloat16>,
+                                         detail::activation_bfloat16<Op>,
+                                         detail::activation_fixed<Op, T, InFracBits, OutFracBits>>;
+
+public:
+    /**
+     * \brief Number of elements processed per operation.
+     */
+    static constexpr unsigned lanes = impl_type::lanes;
+
+    activation() = default;
+
+    activation(const activation &) = delete;
+    activation &operator=(const activation &) = delete;
+
+    /**
+     * \brief Applies the activation function to a vector.
+     */
+    __aie_inline
+    vector<T, lanes> operator()(const vector<T, lanes> &v)
+    {
+        return impl_.run(v);
+    }
+
+    /**
+     * \brief Applies the activation function to a buffer.
+     *
+     * @param in  Input values. Must meet the alignment requirements of a vector of lanes elements.
+     * @param n   Number of values. Must be a multiple of lanes.
+     * @param out Output values. Must meet the alignment requirements of a vector of lanes elements.
+     */
+    __aie_inline
+    void run(const T * __restrict in, unsigned n, T * __restrict out)
+    {
+        REQUIRES_MSG(n % lanes == 0, "Number of values must be a multiple of lanes");
+
+#if !AIE_API_DISABLE_ALIGNMENT_ASSERTIONS
+        RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment<lanes>(in),  "Insufficient input alignment");
+        RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment<lanes>(out), "Insufficient output alignment");
+#endif
+
+        for (unsigned i = 0; i < n / lanes; ++i)
+            chess_prepare_for_pipelining
+        {
+            store_v(out, impl_.run(load_v<lanes>(in)));
+            in  += lanes;
+            out += lanes;
+        }
+    }
+
+private:
+    impl_type impl_;
+};
+
+} // namespace aie
+
+#endif
@@ -50,6 +50,7 @@
 #include "detail/elementary.hpp"
 #include "detail/fft.hpp"
 #include "detail/filter.hpp"
+#include "detail/gather.hpp"
 #include "detail/interleave.hpp"
 #include "detail/ld_st.hpp"
 #include "detail/linear_approx.hpp"
@@ -60,6 +61,7 @@
 #include "detail/neg.hpp"
 #include "detail/parallel_lookup.hpp"
 #include "detail/reverse.hpp"
+#include "detail/scan.hpp"
 #include "detail/shift.hpp"
 #include "detail/shuffle.hpp"
 #include "detail/square.hpp"
@@ -828,6 +830,66 @@ T1 *store_floor_v(T1 *ptr, const vector<T2, Elems> &v, unsigned n = Elems)
     return store_floor_bytes_v<Resource>(ptr, v, n * sizeof(T2));
 }
 
+/**
+ * @ingroup group_memory
+ *
+ * Loads a vector from the elements of an array at the positions given by an index vector.
+ *
+ * @code
+ * for (unsigned i = 0; i < Elems; ++i)
+ *     out[i] = ptr[idx[i]];
+ * @endcode
+ *
+ * When the indices are consecutive, as in contiguous runs of an embedding table, the vector is read with a single
+ * unaligned vector load. Otherwise the elements are read with scalar loads, which the compiler can software pipeline,
+ * into a temporary buffer that is then loaded as a vector.
+ *
+ * @param ptr Base address of the array. Must be aligned to T.
+ * @param idx Vector of element offsets from ptr. Its element type must be int16, uint16, int32 or uint32. The index
+ *            vector and the loaded vector must not be wider than 1024b.
+ */
+template <aie_dm_resource Resource = aie_dm_resource::none, DecoratedElemBaseType T, Vector IdxVec>
+    requires(Utils::is_one_of_v<typename IdxVec::value_type, int16, uint16, int32, uint32> && IdxVec::bits() <= 1024 &&
+             detail::type_bits_v<T> >= 8 && detail::type_bits_v<T> * IdxVec::size() <= 1024)
+__aie_inline
+auto gather(const T *ptr, const IdxVec &idx) -> vector<aie_dm_resource_remove_t<T>, IdxVec::size()>
+{
+    using IndexT = typename IdxVec::value_type;
+    constexpr unsigned Elems = IdxVec::size();
+
+    return detail::gather_scatter<const T, IndexT, Elems, Resource>::gather(ptr, idx);
+}
+
+/**
+ * @ingroup group_memory
+ *
+ * Stores the elements of a vector into an array at the positions given by an index vector.
+ *
+ * @code
+ * for (unsigned i = 0; i < Elems; ++i)
+ *     ptr[idx[i]] = v[i];
+ * @endcode
+ *
+ * When the indices are consecutive the vector is written with a single unaligned vector store. Otherwise elements are
+ * written with scalar stores in lane order, so the last lane wins when indices are repeated.
+ *
+ * @param ptr Base address of the array. Must be aligned to T.
+ * @param idx Vector of element offsets from ptr. Its element type must be int16, uint16, int32 or uint32. The index
+ *            vector and the stored vector must not be wider than 1024b.
+ * @param v   Vector to be written to memory. Must have the same size as idx.
+ */
+template <aie_dm_resource Resource = aie_dm_resource::none, DecoratedElemBaseType T1, Vector IdxVec, ElemBaseType T2>
+    requires(std::is_same_v<aie_dm_resource_remove_t<T1>, T2> && Utils::is_one_of_v<typename IdxVec::value_type, int16, uint16, int32, uint32> &&
+             IdxVec::bits() <= 1024 && detail::type_bits_v<T2> >= 8 && detail::type_bits_v<T2> * IdxVec::size() <= 1024)
+__aie_inline
+void scatter(T1 *ptr, const IdxVec &idx, const vector<T2, IdxVec::size()> &v)
+{
+    using IndexT = typename IdxVec::value_type;
+    constexpr unsigned Elems = IdxVec::size();
+
+    detail::gather_scatter<T1, IndexT, Elems, Resource>::scatter(ptr, idx, v);
+}
+
 /**
  * @ingroup group_basic_types_conversion
  *
@@ -2296,6 +2358,130 @@ typename Vec::value_type min_reduce(const Vec &v)
     return reduce_min(v);
 }
 
+/**
+ * @ingroup group_reduce
+ *
+ * Returns the largest value of the input vector and the index of its first occurrence.
+ *
+ * @param v Input vector. The type must meet @ref aie::RealVector.
+ */
+template <RealVector Vec>
+__aie_inline
+auto reduce_argmax(const Vec &v) -> std::pair<typename Vec::value_type, unsigned>
+{
+    const auto max = reduce_max(v);
+
+    return { max, detail::first_set_lane(eq(v, max)) };
+}
+
+/**
+ * @ingroup group_reduce
+ *
+ * Returns the smallest value of the input vector and the index of its first occurrence.
+ *
+ * @param v Input vector. The type must meet @ref aie::RealVector.
+ */
+template <RealVector Vec>
+__aie_inline
+auto reduce_argmin(const Vec &v) -> std::pair<typename Vec::value_type, unsigned>
+{
+    const auto min = reduce_min(v);
+
+    return { min, detail::first_set_lane(eq(v, min)) };
+}
+
+/**
+ * @ingroup group_reduce
+ *
+ * Returns the largest value of a buffer and the index of its first occurrence, processing Elems elements per
+ * iteration.
+ *
+ * Each lane keeps its running maximum and, in a parallel vector, the iteration in which it was found. Both are updated
+ * with the mask returned by @ref max_cmp, so the loop body has no scalar operations. Lanes are combined at the end.
+ *
+ * @tparam Elems Number of elements processed per iteration.
+ *
+ * @param in Input buffer. Must meet the alignment requirements of a vector of Elems elements.
+ * @param n  Number of elements. Must be a non-zero multiple of Elems, and at most 32768 * Elems.
+ */
+template <unsigned Elems, ElemBaseType T> requires(!detail::is_complex_v<T>)
+__aie_inline
+std::pair<T, unsigned> reduce_argmax(const T *in, unsigned n)
+{
+    REQUIRES_MSG(n > 0 && n % Elems == 0, "Number of elements must be a non-zero multiple of the vector size");
+    REQUIRES_MSG(n / Elems <= 32768, "Too many elements");
+
+#if !AIE_API_DISABLE_ALIGNMENT_ASSERTIONS
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment<Elems>(in), "Insufficient input alignment");
+#endif
+
+    vector<T, Elems>     m   = load_v<Elems>(in);
+    vector<int16, Elems> idx = zeros<int16, Elems>();
+    in += Elems;
+
+    for (unsigned i = 1; i < n / Elems; ++i)
+        chess_prepare_for_pipelining
+    {
+        // Lanes are only updated by strictly larger values, which keeps the first occurrence
+        const auto [m_new, greater] = max_cmp(m, load_v<Elems>(in));
+        in += Elems;
+
+        idx = select(idx, broadcast<int16, Elems>(int16(i)), greater);
+        m   = m_new;
+    }
+
+    // Among the lanes that hold the maximum, the first occurrence is in the earliest iteration and then the lowest lane
+    const T           max   = reduce_max(m);
+    const mask<Elems> hit   = eq(m, max);
+    const int16       first = reduce_min(select(broadcast<int16, Elems>(int16(32767)), idx, hit));
+
+    return { max, unsigned(first) * Elems + detail::first_set_lane(hit & eq(idx, first)) };
+}
+
+/**
+ * @ingroup group_reduce
+ *
+ * Returns the smallest value of a buffer and the index of its first occurrence, processing Elems elements per
+ * iteration. See @ref reduce_argmax for the details of the implementation.
+ *
+ * @tparam Elems Number of elements processed per iteration.
+ *
+ * @param in Input buffer. Must meet the alignment requirements of a vector of Elems elements.
+ * @param n  Number of elements. Must be a non-zero multiple of Elems, and at most 32768 * Elems.
+ */
+template <unsigned Elems, ElemBaseType T> requires(!detail::is_complex_v<T>)
+__aie_inline
+std::pair<T, unsigned> reduce_argmin(const T *in, unsigned n)
+{
+    REQUIRES_MSG(n > 0 && n % Elems == 0, "Number of elements must be a non-zero multiple of the vector size");
+    REQUIRES_MSG(n / Elems <= 32768, "Too many elements");
+
+#if !AIE_API_DISABLE_ALIGNMENT_ASSERTIONS
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment<Elems>(in), "Insufficient input alignment");
+#endif
+
+    vector<T, Elems>     m   = load_v<Elems>(in);
+    vector<int16, Elems> idx = zeros<int16, Elems>();
+    in += Elems;
+
+    for (unsigned i = 1; i < n / Elems; ++i)
+        chess_prepare_for_pipelining
+    {
+        // The mask is set where the running minimum is kept, including ties, which keeps the first occurrence
+        const auto [m_new, keep] = min_cmp(load_v<Elems>(in), m);
+        in += Elems;
+
+        idx = select(broadcast<int16, Elems>(int16(i)), idx, keep);
+        m   = m_new;
+    }
+
+    const T           min   = reduce_min(m);
+    const mask<Elems> hit   = eq(m, min);
+    const int16       first = reduce_min(select(broadcast<int16, Elems>(int16(32767)), idx, hit));
+
+    return { min, unsigned(first) * Elems + detail::first_set_lane(hit & eq(idx, first)) };
+}
+
 template <RealVector Vec1, RealVector Vec2> requires(is_same_vector_v<Vec1, Vec2>)
 __aie_inline
 auto min_cmp(const Vec1 &v1, const Vec2 &v2) -> std::tuple<aie_dm_resource_remove_t<Vec1>, mask<Vec1::size()>>
@@ -4231,6 +4417,201 @@ auto add_reduce_v(const Vec &v, const Others &... others) -> aie_dm_resource_rem
     return reduce_add_v(v, others...);
 }
 
+/**
+ * @ingroup group_reduce
+ *
+ * Returns the inclusive prefix sum of the input vector.
+ *
+ * @code
+ * out[0] = v[0];
+ * for (unsigned i = 1; i < Elems; ++i)
+ *     out[i] = out[i - 1] + v[i];
+ * @endcode
+ *
+ * The scan is computed in log2(Elems) shift and add steps. Vectors larger than the native vector size are scanned in
+ * native chunks and the running total is propagated across chunks.
+ *
+ * @param v Input vector. The type must meet @ref aie::Vector.
+ */
+template <Vector Vec>
+__aie_inline
+auto inclusive_scan(const Vec &v) -> aie_dm_resource_remove_t<Vec>
+{
+    using T = typename Vec::value_type;
+    constexpr unsigned Elems = Vec::size();
+
+    return detail::scan<T, Elems>::run_inclusive(v);
+}
+
+/**
+ * @ingroup group_reduce
+ *
+ * Returns the exclusive prefix sum of the input vector.
+ *
+ * @code
+ * out[0] = 0;
+ * for (unsigned i = 1; i < Elems; ++i)
+ *     out[i] = out[i - 1] + v[i - 1];
+ * @endcode
+ *
+ * @param v Input vector. The type must meet @ref aie::Vector.
+ */
+template <Vector Vec>
+__aie_inline
+auto exclusive_scan(const Vec &v) -> aie_dm_resource_remove_t<Vec>
+{
+    using T = typename Vec::value_type;
+    constexpr unsigned Elems = Vec::size();
+
+    return detail::scan<T, Elems>::run_exclusive(v);
+}
+
+/**
+ * @ingroup group_reduce
+ *
+ * Returns the inclusive prefix sum of the input accumulator. Accumulation happens at the precision of the accumulator,
+ * so it can be used when the partial sums exceed the range of the vector type.
+ *
+ * @code
+ * out[0] = acc[0];
+ * for (unsigned i = 1; i < Elems; ++i)
+ *     out[i] = out[i - 1] + acc[i];
+ * @endcode
+ *
+ * @param acc Input accumulator. The type must meet @ref aie::Accum.
+ */
+template <Accum Acc> requires(arch::is(arch::Gen2))
+__aie_inline
+auto inclusive_scan(const Acc &acc) -> aie_dm_resource_remove_t<Acc>
+{
+    using T = typename Acc::value_type;
+    constexpr unsigned Elems = Acc::size();
+
+    return detail::scan_accum<T, Elems>::run_inclusive(acc);
+}
+
+/**
+ * @ingroup group_reduce
+ *
+ * Returns the exclusive prefix sum of the input accumulator.
+ *
+ * @code
+ * out[0] = 0;
+ * for (unsigned i = 1; i < Elems; ++i)
+ *     out[i] = out[i - 1] + acc[i - 1];
+ * @endcode
+ *
+ * @param acc Input accumulator. The type must meet @ref aie::Accum.
+ */
+template <Accum Acc> requires(arch::is(arch::Gen2))
+__aie_inline
+auto exclusive_scan(const Acc &acc) -> aie_dm_resource_remove_t<Acc>
+{
+    using T = typename Acc::value_type;
+    constexpr unsigned Elems = Acc::size();
+
+    return detail::scan_accum<T, Elems>::run_exclusive(acc);
+}
+
+/**
+ * @ingroup group_reduce
+ *
+ * Computes the inclusive prefix sum of a buffer, processing Elems elements per iteration. The running total is
+ * propagated from each vector to the next one, and it is returned so that long streams can be scanned in blocks by
+ * passing it as the initial value of the next call.
+ *
+ * @code
+ * T total = 0;
+ * total = aie::inclusive_scan<16>(in,       256, out,       total);
+ * total = aie::inclusive_scan<16>(in + 256, 256, out + 256, total);
+ * @endcode
+ *
+ * @tparam Elems Number of elements processed per iteration.
+ *
+ * @param in   Input buffer. Must meet the alignment requirements of a vector of Elems elements.
+ * @param n    Number of elements. Must be a multiple of Elems.
+ * @param out  Output buffer. Must meet the alignment requirements of a vector of Elems elements. It can be the same as
+ *             the input buffer.
+ * @param init Value added to all the outputs.
+ *
+ * @return Sum of init and all the input elements.
+ */
+template <unsigned Elems, ElemBaseType T>
+__aie_inline
+T inclusive_scan(const T *in, unsigned n, T *out, T init = T(0))
+{
+    REQUIRES_MSG(n % Elems == 0, "Number of elements must be a multiple of the vector size");
+
+#if !AIE_API_DISABLE_ALIGNMENT_ASSERTIONS
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment<Elems>(in),  "Insufficient input alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment<Elems>(out), "Insufficient output alignment");
+#endif
+
+    vector<T, Elems> carry = broadcast<T, Elems>(init);
+
+    for (unsigned i = 0; i < n / Elems; ++i)
+        chess_prepare_for_pipelining
+        chess_loop_range(1,)
+    {
+        const vector<T, Elems> v = add(inclusive_scan(load_v<Elems>(in)), carry);
+        in += Elems;
+
+        carry = broadcast<T, Elems>(v[Elems - 1]);
+
+        store_v(out, v);
+        out += Elems;
+    }
+
+    return carry[0];
+}
+
+/**
+ * @ingroup group_reduce
+ *
+ * Computes the exclusive prefix sum of a buffer, processing Elems elements per iteration. The running total is
+ * propagated from each vector to the next one, and it is returned so that long streams can be scanned in blocks by
+ * passing it as the initial value of the next call.
+ *
+ * @tparam Elems Number of elements processed per iteration.
+ *
+ * @param in   Input buffer. Must meet the alignment requirements of a vector of Elems elements.
+ * @param n    Number of elements. Must be a multiple of Elems.
+ * @param out  Output buffer. Must meet the alignment requirements of a vector of Elems elements. It can be the same as
+ *             the input buffer.
+ * @param init Value of the first output, also added to the rest of outputs.
+ *
+ * @return Sum of init and all the input elements.
+ */
+template <unsigned Elems, ElemBaseType T>
+__aie_inline
+T exclusive_scan(const T *in, unsigned n, T *out, T init = T(0))
+{
+    REQUIRES_MSG(n % Elems == 0, "Number of elements must be a multiple of the vector size");
+
+#if !AIE_API_DISABLE_ALIGNMENT_ASSERTIONS
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment<Elems>(in),  "Insufficient input alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment<Elems>(out), "Insufficient output alignment");
+#endif
+
+    vector<T, Elems> carry = broadcast<T, Elems>(init);
+
+    for (unsigned i = 0; i < n / Elems; ++i)
+        chess_prepare_for_pipelining
+        chess_loop_range(1,)
+    {
+        const vector<T, Elems> v = add(inclusive_scan(load_v<Elems>(in)), carry);
+        in += Elems;
+
+        // The last element of the previous running total is shifted into the first lane
+        store_v(out, shuffle_up_fill(v, carry, 1));
+        out += Elems;
+
+        carry = broadcast<T, Elems>(v[Elems - 1]);
+    }
+
+    return carry[0];
+}
+
 /**
  * @ingroup group_arithmetic
  *
@@ -6548,6 +6929,107 @@ private:
     parallel_lookup_impl parallel_lookup_;
 };
 
+/**
+ * @ingroup group_lut
+ *
+ * Interval of the function domain covered by a lookup table built with @ref make_lut. Entry i of a table with Elems
+ * entries covers [first + i * (last - first) / Elems, first + (i + 1) * (last - first) / Elems).
+ */
+struct lut_range
+{
+    double first;
+    double last;
+};
+
+/**
+ * @ingroup group_lut
+ *
+ * Builds the contents of a lookup table for @ref linear_approx by sampling a function. Each entry holds the slope and
+ * offset of the segment of the function it covers. The slope is the chord of the segment, and the offset is centered
+ * between the largest deviations of the function from that chord, which minimizes the maximum error for functions that
+ * are convex or concave within each segment.
+ *
+ * The returned object holds the values already replicated and interleaved at bank width granularity, as required for
+ * the given number of parallel accesses, and is aligned to @ref aie::vector_decl_align. For 4 parallel accesses a
+ * second copy of the table must be placed in a different memory bank. The function is evaluated in double precision
+ * and, when it can be evaluated in a constant expression, the table can be declared constexpr and built at compile
+ * time:
+ *
+ * @code
+ * // sigmoid(x) for int16 input in Q4.11, which spans [-16, 16), and output in Q.15. Each of the 32 entries covers an
+ * // interval of width 1.0, that is 2^11 inputs, and the bias of 16 maps the integer part of the input to an entry.
+ * auto sigmoid = [](double x) { return 32768.0 / (1.0 + std::exp(-x)); };
+ *
+ * alignas(aie::vector_decl_align) static const auto lut_ab = aie::make_lut<4, int16, int16, 32>(sigmoid, {-16.0, 16.0}, 11, 8);
+ * alignas(aie::vector_decl_align) static const auto lut_cd = lut_ab;
+ *
+ * aie::lut<4, int16, int16> lookup_table(lut_ab.size(), lut_ab.data(), lut_cd.data());
+ * aie::linear_approx<int16, decltype(lookup_table)> approx(lookup_table, 11, 16, 8);
+ * aie::vector<int16, 16> y = approx.compute(x).template to_vector<int16>(8);
+ * @endcode
+ *
+ * For integer tables, func returns values in the units of the offset, and slopes are scaled to be multiplied by the
+ * remainder of the input in [0, 2^step_bits) and added to the offset shifted by shift_offset. For floating-point tables
+ * the slope is rounded to bfloat16 and the offset is computed so that slope * input + offset approximates func, which
+ * requires the range to match the indexing of the input (last - first == Elems << step_bits).
+ *
+ * <table>
+ * <caption>Supported table types</caption>
+ * <tr><th>Offset<th>Slope<th>Storage
+ * <tr><td>int8    <td>int8     <td>int8
+ * <tr><td>int16   <td>int16    <td>int16
+ * <tr><td>int32   <td>int32    <td>int32
+ * <tr><td>float   <td>bfloat16 <td>float
+ * </table>
+ *
+ * @param func         Function to approximate, called with double values in the range.
+ * @param range        Interval of the domain of func covered by the table.
+ * @param step_bits    Number of input bits used as the remainder by @ref linear_approx.
+ * @param shift_offset Shift that will be applied to the offsets by @ref linear_approx. Must not be negative.
+ *
+ * @tparam ParallelAccesses Number of parallel accesses of the @ref lut the table is used with.
+ * @tparam OffsetType       Type of the offsets.
+ * @tparam SlopeType        Type of the slopes.
+ * @tparam Elems            Number of entries of the table.
+ */
+template <unsigned ParallelAccesses, typename OffsetType, typename SlopeType, unsigned Elems, typename Fn>
+    requires(arch::is(arch::Gen2) && (ParallelAccesses == 1 || ParallelAccesses == 2 || ParallelAccesses == 4) &&
+             ((std::is_same_v<OffsetType, SlopeType> && Utils::is_one_of_v<OffsetType, int8, int16, int32>) ||
+              (std::is_same_v<OffsetType, float> && std::is_same_v<SlopeType, bfloat16>)))
+constexpr auto make_lut(Fn &&func, lut_range range, unsigned step_bits, int shift_offset = 0)
+{
+    return detail::make_linear_approx_lut<ParallelAccesses, OffsetType, SlopeType, Elems>(func, range.first, range.last,
+                                                                                          step_bits, shift_offset);
+}
+
+/**
+ * @ingroup group_lut
+ *
+ * Builds the contents of a lookup table for @ref parallel_lookup by sampling a function at the beginning of each entry
+ * of the range. Integer values are rounded to the nearest value and saturated, and 8b values are stored as 16b values.
+ * The layout of the returned object is the same as for the linear approximation overload.
+ *
+ * @code
+ * alignas(aie::vector_decl_align) static constexpr auto lut_ab = aie::make_lut<2, int16, 64>(func, {0.0, 1.0});
+ *
+ * aie::lut<2, int16> lookup_table(lut_ab.size(), lut_ab.data());
+ * @endcode
+ *
+ * @param func  Function to tabulate, called with double values in the range.
+ * @param range Interval of the domain of func covered by the table.
+ *
+ * @tparam ParallelAccesses Number of parallel accesses of the @ref lut the table is used with.
+ * @tparam T                Type of the values.
+ * @tparam Elems            Number of entries of the table.
+ */
+template <unsigned ParallelAccesses, typename T, unsigned Elems, typename Fn>
+    requires(arch::is(arch::Gen2) && (ParallelAccesses == 1 || ParallelAccesses == 2 || ParallelAccesses == 4) &&
+             Utils::is_one_of_v<T, int8, uint8, int16, uint16, int32, uint32, float>)
+constexpr auto make_lut(Fn &&func, lut_range range)
+{
+    return detail::make_lookup_lut<ParallelAccesses, T, Elems>(func, range.first, range.last);
+}
+
 using dim_2d                = detail::dim_2d;
 using dim_3d                = detail::dim_3d;
 using sliding_window_dim_1d = detail::sliding_window_dim_1d;
@@ -6564,7 +7046,7 @@ struct tensor_dim
 };
 
 template <unsigned Rank, typename T, unsigned Elems, typename NativeRepr = detail::default_repr_t<Rank>>
-    requires (arch::is(arch::Gen2) && Rank > 0)
+    requires (Rank > 0)
 class tensor_descriptor
 {
 public:
@@ -6586,21 +7068,22 @@ public:
 private:
 #if __AIE_API_SUPPORTED_FRIEND_CONCEPTS__
     template <aie_dm_resource Resource, DecoratedElemBaseType T2, typename TensorDescriptor>
-        requires (arch::is(arch::Gen2))
     friend constexpr auto make_tensor_buffer_stream(T2 *base, const TensorDescriptor& dims);
     template <aie_dm_resource Resource, DecoratedElemBaseType T2, typename TensorDescriptor>
-        requires (arch::is(arch::Gen2))
     friend constexpr auto make_tensor_buffer_stream(const T2 *base, const TensorDescriptor& dims);
     template <aie_dm_resource Resource, DecoratedElemBaseType T2, typename TensorDescriptor>
-        requires (arch::is(arch::Gen2))
     friend constexpr auto make_restrict_tensor_buffer_stream(T2 *base, const TensorDescriptor& dims);
+    template <aie_dm_resource Resource, DecoratedElemBaseType T2, typename TensorDescriptor>
+    friend constexpr auto make_circular_tensor_buffer_stream(T2 *base, unsigned size, unsigned offset, const TensorDescriptor& dims);
+    template <aie_dm_resource Resource, DecoratedElemBaseType T2, typename TensorDescriptor>
+    friend constexpr auto make_circular_tensor_buffer_stream(const T2 *base, unsigned size, unsigned offset, const TensorDescriptor& dims);
 
     template <typename T2, unsigned Elems2, typename... Args>
-        requires (arch::is(arch::Gen2) && (Utils::is_one_of_v<std::decay_t<Args>, int, dim_2d, dim_3d> && ...))
+        requires (Utils::is_one_of_v<std::decay_t<Args>, int, dim_2d, dim_3d> && ...)
     friend constexpr auto make_tensor_descriptor_from_native(Args&&... args);
     template <typename T2, unsigned Elems2, typename... Args>
-        requires (arch::is(arch::Gen2) &&
-                  (Utils::is_one_of_v<std::decay_t<Args>, int, dim_2d, dim_3d, sliding_window_dim_1d, sliding_window_dim_2d, sliding_window_dim_3d> && ...))
+        requires ((Utils::is_one_of_v<std::decay_t<Args>, int, dim_2d, dim_3d> ||
+                   (arch::is(arch::Gen2) && Utils::is_one_of_v<std::decay_t<Args>, sliding_window_dim_1d, sliding_window_dim_2d, sliding_window_dim_3d>)) && ...)
     friend constexpr auto make_tensor_descriptor_from_native_bytes(Args&&... args);
 #else
     template <aie_dm_resource Resource, typename T2, typename TensorDescriptor>
@@ -6609,6 +7092,10 @@ private:
     friend constexpr auto make_tensor_buffer_stream(const T2 *base, const TensorDescriptor& dims);
     template <aie_dm_resource Resource, typename T2, typename TensorDescriptor>
     friend constexpr auto make_restrict_tensor_buffer_stream(T2 *base, const TensorDescriptor& dims);
+    template <aie_dm_resource Resource, typename T2, typename TensorDescriptor>
+    friend constexpr auto make_circular_tensor_buffer_stream(T2 *base, unsigned size, unsigned offset, const TensorDescriptor& dims);
+    template <aie_dm_resource Resource, typename T2, typename TensorDescriptor>
+    friend constexpr auto make_circular_tensor_buffer_stream(const T2 *base, unsigned size, unsigned offset, const TensorDescriptor& dims);
 
     template <typename T2, unsigned Elems2, typename... Args>
     friend constexpr auto make_tensor_descriptor_from_native(Args&&... args);
@@ -6677,7 +7164,7 @@ private:
 };
 
 template <typename T, unsigned Elems, typename... Args>
-    requires (arch::is(arch::Gen2) && (std::is_same_v<Args, tensor_dim> && ...))
+    requires (std::is_same_v<Args, tensor_dim> && ...)
 __aie_inline
 constexpr auto make_tensor_descriptor(Args&&... args)
 {
@@ -6687,7 +7174,7 @@ constexpr auto make_tensor_descriptor(Args&&... args)
 }
 
 template <typename T, unsigned Elems, typename... Args>
-    requires (arch::is(arch::Gen2) && (std::is_same_v<Args, tensor_dim> && ...))
+    requires (std::is_same_v<Args, tensor_dim> && ...)
 __aie_inline
 constexpr auto make_tensor_descriptor_bytes(Args&&... args)
 {
@@ -6698,7 +7185,7 @@ constexpr auto make_tensor_descriptor_bytes(Args&&... args)
 
 template <typename T, unsigned Elems, typename... Args>
 #if __AIE_API_SUPPORTED_FRIEND_CONCEPTS__
-    requires (arch::is(arch::Gen2) && (Utils::is_one_of_v<std::decay_t<Args>, int, dim_2d, dim_3d> && ...))
+    requires (Utils::is_one_of_v<std::decay_t<Args>, int, dim_2d, dim_3d> && ...)
 #endif
 __aie_inline
 constexpr auto make_tensor_descriptor_from_native(Args&&... args)
@@ -6719,8 +7206,8 @@ constexpr auto make_tensor_descriptor_from_native(Args&&... args)
 
 template <typename T, unsigned Elems, typename... Args>
 #if __AIE_API_SUPPORTED_FRIEND_CONCEPTS__
-    requires (arch::is(arch::Gen2) &&
-              (Utils::is_one_of_v<std::decay_t<Args>, int, dim_2d, dim_3d, sliding_window_dim_1d, sliding_window_dim_2d, sliding_window_dim_3d> && ...))
+    requires ((Utils::is_one_of_v<std::decay_t<Args>, int, dim_2d, dim_3d> ||
+               (arch::is(arch::Gen2) && Utils::is_one_of_v<std::decay_t<Args>, sliding_window_dim_1d, sliding_window_dim_2d, sliding_window_dim_3d>)) && ...)
 #endif
 __aie_inline
 constexpr auto make_tensor_descriptor_from_native_bytes(Args&&... args)
@@ -6743,7 +7230,6 @@ constexpr auto make_tensor_descriptor_from_native_bytes(Args&&... args)
 
 #if __AIE_API_SUPPORTED_FRIEND_CONCEPTS__
 template <aie_dm_resource Resource = aie_dm_resource::none, DecoratedElemBaseType T, typename TensorDescriptor>
-    requires (arch::is(arch::Gen2))
 #else
 template <aie_dm_resource Resource = aie_dm_resource::none, typename T, typename TensorDescriptor>
 #endif
@@ -6766,7 +7252,6 @@ constexpr auto make_tensor_buffer_stream(T *base, const TensorDescriptor& tensor
 
 #if __AIE_API_SUPPORTED_FRIEND_CONCEPTS__
 template <aie_dm_resource Resource = aie_dm_resource::none, DecoratedElemBaseType T, typename TensorDescriptor>
-    requires (arch::is(arch::Gen2))
 #else
 template <aie_dm_resource Resource = aie_dm_resource::none, typename T, typename TensorDescriptor>
 #endif
@@ -6790,7 +7275,6 @@ constexpr auto make_tensor_buffer_stream(const T *base, const TensorDescriptor&
 
 #if __AIE_API_SUPPORTED_FRIEND_CONCEPTS__
 template <aie_dm_resource Resource = aie_dm_resource::none, DecoratedElemBaseType T, typename TensorDescriptor>
-    requires (arch::is(arch::Gen2))
 #else
 template <aie_dm_resource Resource = aie_dm_resource::none, typename T, typename TensorDescriptor>
 #endif
@@ -6811,6 +7295,54 @@ constexpr auto make_restrict_tensor_buffer_stream(T * __restrict base, const Ten
     }
 }
 
+#if __AIE_API_SUPPORTED_FRIEND_CONCEPTS__
+template <aie_dm_resource Resource = aie_dm_resource::none, DecoratedElemBaseType T, typename TensorDescriptor>
+#else
+template <aie_dm_resource Resource = aie_dm_resource::none, typename T, typename TensorDescriptor>
+#endif
+__aie_inline
+constexpr auto make_circular_tensor_buffer_stream(T *base, unsigned size, unsigned offset, const TensorDescriptor& tensor_desc)
+{
+    static_assert(std::is_same_v<T, typename TensorDescriptor::type>, "Input data type does not match tensor descriptor");
+    constexpr unsigned Elems = TensorDescriptor::elems;
+    using iter_desc_t = typename std::decay_t<TensorDescriptor>::tensor_iteration_descriptor;
+
+    REQUIRES_MSG(size % Elems == 0 && offset % Elems == 0 && offset < size,
+                 "Size and offset must be multiples of the vector size, and offset smaller than size");
+
+#if !AIE_API_DISABLE_ALIGNMENT_ASSERTIONS
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment<Elems>(base), "Insufficient alignment");
+#endif
+
+    const detail::tensor_circular_range<true> range{base, int(size * sizeof(T))};
+
+    return detail::tensor_buffer_stream<T, Elems, 0, iter_desc_t, Resource, /*Restrict=*/false, /*Circular=*/true>(base + offset, tensor_desc.it_desc_, range);
+}
+
+#if __AIE_API_SUPPORTED_FRIEND_CONCEPTS__
+template <aie_dm_resource Resource = aie_dm_resource::none, DecoratedElemBaseType T, typename TensorDescriptor>
+#else
+template <aie_dm_resource Resource = aie_dm_resource::none, typename T, typename TensorDescriptor>
+#endif
+__aie_inline
+constexpr auto make_circular_tensor_buffer_stream(const T *base, unsigned size, unsigned offset, const TensorDescriptor& tensor_desc)
+{
+    static_assert(std::is_same_v<T, typename TensorDescriptor::type>, "Input data type does not match tensor descriptor");
+    constexpr unsigned Elems = TensorDescriptor::elems;
+    using iter_desc_t = typename std::decay_t<TensorDescriptor>::tensor_iteration_descriptor;
+
+    REQUIRES_MSG(size % Elems == 0 && offset % Elems == 0 && offset < size,
+                 "Size and offset must be multiples of the vector size, and offset smaller than size");
+
+#if !AIE_API_DISABLE_ALIGNMENT_ASSERTIONS
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment<Elems>(base), "Insufficient alignment");
+#endif
+
+    const detail::tensor_circular_range<true> range{base, int(size * sizeof(T))};
+
+    return detail::tensor_buffer_stream<const T, Elems, 0, iter_desc_t, Resource, /*Restrict=*/false, /*Circular=*/true>(base + offset, tensor_desc.it_desc_, range);
+}
+
 /**
  * @ingroup group_elementary
  */
@@ -6999,17 +7531,19 @@ auto invsqrt(const Vec &v) -> aie_dm_resource_remove_t<Vec>
  * @ingroup group_elementary
  *
  * Performs a cosine operation on all elements in the input vector. The input vector can either be of float values in
- * radians or integers. The floating-point range is [-Pi, Pi]. Integer values are handled as a fixed-point input value
+ * radians or integers. The floating-point range is [-Pi, Pi]. int32 values are handled as a fixed-point input value
  * in Q1.31 format scaled with 1/Pi (input value 2^31 corresponds to Pi). In this case only the upper 20-bit of the
- * input value are used.
+ * input value are used. int16 values are handled as a fixed-point input value in Q1.15 format scaled with 1/Pi (input
+ * value 2^15 corresponds to Pi) on all architectures.
  *
  * According to input type, returns a vector of float or of signed Q.15 fixed-point format.
  *
  * @param v Input vector. The type must meet @ref aie::RealVector.
  *
- * \note This is a scalar operation. Even though the function operates with vectors, the actual operation is applied to each element individually.
+ * \note On AIE this is a scalar operation. Even though the function operates with vectors, the actual operation is
+ * applied to each element individually. See @ref sincos for the vectorized implementation used on AIE-ML and XDNA 2.
  */
-template <RealVector Vec> requires (arch::is(arch::AIE))
+template <RealVector Vec> requires (arch::is(arch::AIE) || detail::is_vector_sincos_supported_v<typename Vec::value_type>)
 __aie_inline
 auto cos(const Vec &v) -> aie_dm_resource_remove_t<Vec>
 {
@@ -7026,17 +7560,19 @@ auto cos(const Vec &v) -> aie_dm_resource_remove_t<Vec>
  * @ingroup group_elementary
  *
  * Performs a sine operation on all elements in the input vector. The input vector can either be of float values in
- * radians or integers. The floating-point range is [-Pi, Pi]. Integer values are handled as a fixed-point input value
+ * radians or integers. The floating-point range is [-Pi, Pi]. int32 values are handled as a fixed-point input value
  * in Q1.31 format scaled with 1/Pi (input value 2^31 corresponds to Pi). In this case only the upper 20-bit of the
- * input value are used.
+ * input value are used. int16 values are handled as a fixed-point input value in Q1.15 format scaled with 1/Pi (input
+ * value 2^15 corresponds to Pi) on all architectures.
  *
  * According to input type, returns a vector of float or of signed Q.15 fixed-point format.
  *
  * @param v Input vector. The type must meet @ref aie::RealVector.
  *
- * \note This is a scalar operation. Even though the function operates with vectors, the actual operation is applied to each element individually.
+ * \note On AIE this is a scalar operation. Even though the function operates with vectors, the actual operation is
+ * applied to each element individually. See @ref sincos for the vectorized implementation used on AIE-ML and XDNA 2.
  */
-template <RealVector Vec> requires (arch::is(arch::AIE))
+template <RealVector Vec> requires (arch::is(arch::AIE) || detail::is_vector_sincos_supported_v<typename Vec::value_type>)
 __aie_inline
 auto sin(const Vec &v) -> aie_dm_resource_remove_t<Vec>
 {
@@ -7057,11 +7593,20 @@ auto sin(const Vec &v) -> aie_dm_resource_remove_t<Vec>
  *
  * According to input type, returns a pair of vectors of float or of signed Q.15 fixed-point format.
  *
+ * Integer inputs use the same formats as in @ref sin and @ref cos: Q1.31 scaled with 1/Pi for int32 and Q1.15 scaled
+ * with 1/Pi for int16 (input value 2^15 corresponds to Pi) on all architectures.
+ *
+ * On AIE-ML and XDNA 2 the operation is vectorized for float, int32 and int16 inputs. The two most significant
+ * bits of the phase select the quadrant, and sine and cosine are approximated within the quadrant with minimax
+ * polynomials evaluated in floating point. The absolute error is below 1e-6 for float results, and fixed-point
+ * results are within 1 LSB of the correctly rounded Q.15 value (+1.0 saturates to 32767).
+ *
  * @param v Input vector. The type must meet @ref aie::RealVector.
  *
- * \note This is a scalar operation. Even though the function operates with vectors, the actual operation is applied to each element individually.
+ * \note On AIE this is a scalar operation. Even though the function operates with vectors, the actual operation is
+ * applied to each element individually.
  */
-template <RealVector Vec> requires (arch::is(arch::AIE))
+template <RealVector Vec> requires (arch::is(arch::AIE) || detail::is_vector_sincos_supported_v<typename Vec::value_type>)
 __aie_inline
 auto sincos(const Vec &v) -> std::pair<aie_dm_resource_remove_t<Vec>, aie_dm_resource_remove_t<Vec>>
 {
@@ -7080,11 +7625,17 @@ auto sincos(const Vec &v) -> std::pair<aie_dm_resource_remove_t<Vec>, aie_dm_res
  * Same as sincos, but returns both values as the real and imaginary parts in a vector of complex values
  * (cos in the real part, sin in the imaginary).
  *
- * According to input type, returns a vector of float or of signed Q.15 fixed-point format.
+ * According to input type, returns a vector of float or of signed Q.15 fixed-point format. Integer inputs use the same
+ * formats as in @ref sincos, and the accuracy on AIE-ML and XDNA 2 is the same as in @ref sincos.
  *
  * @param v Input vector. The type must meet @ref aie::RealVector.
+ *
+ * \note Float inputs are only supported on AIE-ML when complex floating-point emulation is available.
  */
-template <RealVector Vec> requires (arch::is(arch::AIE))
+template <RealVector Vec>
+    requires (arch::is(arch::AIE) ||
+              (detail::is_vector_sincos_supported_v<typename Vec::value_type> &&
+               (!Vec::is_floating_point() || (arch::is(arch::AIE_ML) && __AIE_API_COMPLEX_FP32_EMULATION__ == 1))))
 __aie_inline
 auto sincos_complex(const Vec &v) -> vector<std::conditional_t<Vec::is_floating_point(), cfloat, cint16>, Vec::size()>
 {
@@ -7097,6 +7648,77 @@ auto sincos_complex(const Vec &v) -> vector<std::conditional_t<Vec::is_floating_
         return detail::elementary_vector<detail::ElementaryOp::SinCosComplex, cint16, T, Elems>::run(v);
 }
 
+/**
+ * @ingroup group_elementary
+ *
+ * Computes the arc tangent of y / x for each pair of elements, using the signs of both inputs to determine the
+ * quadrant. Results are in radians in the range [-Pi, Pi], and atan2(0, 0) returns 0.
+ *
+ * The ratio of the smaller to the larger magnitude is reduced to [-tan(Pi/8), tan(Pi/8)] and evaluated with a
+ * polynomial. The maximum error is below 3e-7 radians.
+ *
+ * @param y Vector of ordinates. The type must meet @ref aie::RealVector.
+ * @param x Vector of abscissas. The type must meet @ref aie::RealVector.
+ */
+template <RealVector Vec1, RealVector Vec2>
+    requires(arch::is(arch::Gen2) && Vec1::size() == Vec2::size() &&
+             std::is_same_v<typename Vec1::value_type, float> && std::is_same_v<typename Vec2::value_type, float>)
+__aie_inline
+auto atan2(const Vec1 &y, const Vec2 &x) -> vector<float, Vec1::size()>
+{
+    return detail::atan2_vector<Vec1::size()>::run(y, x);
+}
+
+/**
+ * @ingroup group_elementary
+ *
+ * Computes the phase of each element of a complex vector, as in atan2(imag, real).
+ *
+ * For cfloat inputs, phases are returned in radians in the range [-Pi, Pi]. For cint16 and cint32 inputs, phases are
+ * returned in Q1.15 and Q1.31 format scaled by 1/Pi, the same format accepted by @ref sin and @ref cos. A phase of Pi
+ * saturates to the largest positive value. The accuracy is the same as in @ref atan2, so int32 phases are accurate to
+ * around 2^-23.
+ *
+ * @param v Input vector. The type must meet @ref aie::ComplexVector.
+ *
+ * \note cfloat inputs are only supported on AIE-ML when complex floating-point emulation is available.
+ */
+template <ComplexVector Vec>
+    requires(arch::is(arch::Gen2) && Utils::is_one_of_v<typename Vec::value_type, cint16, cint32, cfloat> &&
+             (!Vec::is_floating_point() || (arch::is(arch::AIE_ML) && __AIE_API_COMPLEX_FP32_EMULATION__ == 1)))
+__aie_inline
+auto arg(const Vec &v) -> vector<detail::utils::get_complex_component_type_t<typename Vec::value_type>, Vec::size()>
+{
+    using T = typename Vec::value_type;
+    constexpr unsigned Elems = Vec::size();
+
+    return detail::polar_vector<detail::PolarOp::Arg, T, Elems>::run(v);
+}
+
+/**
+ * @ingroup group_elementary
+ *
+ * Computes the magnitude of each element of a complex vector, as in sqrt(real * real + imag * imag).
+ *
+ * The magnitude is computed in float from the squared magnitude and a reciprocal square root refined to float precision.
+ * Magnitudes of cint16 and cint32 inputs are rounded to integer and saturated.
+ *
+ * @param v Input vector. The type must meet @ref aie::ComplexVector.
+ *
+ * \note cfloat inputs are only supported on AIE-ML when complex floating-point emulation is available.
+ */
+template <ComplexVector Vec>
+    requires(arch::is(arch::Gen2) && Utils::is_one_of_v<typename Vec::value_type, cint16, cint32, cfloat> &&
+             (!Vec::is_floating_point() || (arch::is(arch::AIE_ML) && __AIE_API_COMPLEX_FP32_EMULATION__ == 1)))
+__aie_inline
+auto abs(const Vec &v) -> vector<detail::utils::get_complex_component_type_t<typename Vec::value_type>, Vec::size()>
+{
+    using T = typename Vec::value_type;
+    constexpr unsigned Elems = Vec::size();
+
+    return detail::polar_vector<detail::PolarOp::Abs, T, Elems>::run(v);
+}
+
 /**
  * @ingroup group_fp_conversion
  *
@@ -7620,6 +8242,143 @@ auto div(const Vec &a, E b)
     return mul(a, divisor);
 }
 
+/**
+ * @ingroup group_arithmetic
+ *
+ * Returns the quotients of the element-wise integer division of each value of the first input vector by the
+ * corresponding element in the second input vector. Quotients are truncated towards zero, as in C++ integer division.
+ *
+ * @code
+ * for (unsigned i = 0; i < Elems; ++i)
+ *     out[i] = a[i] / b[i];
+ * @endcode
+ *
+ * Quotients of magnitudes are estimated with a bfloat16 reciprocal of the divisor refined to float precision with
+ * Newton-Raphson steps. The exact remainder of the estimate is computed in a 64b accumulator and used to refine the
+ * quotient (twice for int32 values, whose magnitude exceeds the float precision), and a final correction makes the
+ * result exact. int32 values equal to the minimum value of the type, whose magnitude does not fit in the type, are
+ * handled separately so that their quotients are exact as well.
+ *
+ * Results of a division by zero are unspecified. Quotients that do not fit in the type (such as -32768 / -1 for int16)
+ * are unspecified.
+ *
+ * @param a Vector of dividends. The type must meet @ref aie::RealVector.
+ * @param b Vector of divisors. The type must meet @ref aie::RealVector.
+ */
+template <RealVector Vec1, RealVector Vec2>
+    requires(arch::is(arch::Gen2) && Vec1::size() == Vec2::size() &&
+             std::is_same_v<typename Vec1::value_type, typename Vec2::value_type> &&
+             Utils::is_one_of_v<typename Vec1::value_type, int16, int32>)
+__aie_inline
+auto div(const Vec1 &a, const Vec2 &b) -> vector<typename Vec1::value_type, Vec1::size()>
+{
+    using T = typename Vec1::value_type;
+    constexpr unsigned Elems = Vec1::size();
+
+    constexpr unsigned native_elems = 16;
+    constexpr unsigned num_op       = Elems < native_elems? 1 : Elems / native_elems;
+    constexpr unsigned steps        = std::is_same_v<T, int16>? 1 : 2;
+
+    vector<T, Elems> ret;
+
+    Utils::unroll_times<num_op>([&](auto idx) __aie_inline {
+        const vector<T, native_elems> va = a.template grow_extract<native_elems>(idx);
+        const vector<T, native_elems> vb = b.template grow_extract<native_elems>(idx);
+
+        vector<int32, native_elems> na, nb;
+        mask<native_elems> a_min, b_min;
+
+        if constexpr (std::is_same_v<T, int16>) {
+            na = abs(va.template unpack<int32>());
+            nb = abs(vb.template unpack<int32>());
+        }
+        else {
+            // The magnitude 2^31 of the minimum value does not fit in int32. Divisors equal to it give a quotient of 1
+            // or 0, selected at the end, and dividends equal to it are divided as 2^31 - |b|, whose quotient is one
+            // less than the one of 2^31.
+            a_min = eq(va, std::numeric_limits<int32>::min());
+            b_min = eq(vb, std::numeric_limits<int32>::min());
+
+            nb = select(abs(vb), broadcast<int32, native_elems>(1), b_min);
+            na = select(abs(va), add(sub(broadcast<int32, native_elems>(std::numeric_limits<int32>::max()), nb), 1), a_min);
+        }
+
+        // The bfloat16 reciprocal is refined to float precision with two Newton-Raphson steps: r = r * (2 - b * r)
+        const vector<float, native_elems> fb = to_float<float>(nb, 0);
+        const vector<bfloat16, native_elems> rb = inv(accum<accfloat, native_elems>(fb).template to_vector<bfloat16>());
+
+        vector<float, native_elems> r = mul(rb, bfloat16(1.0f)).template to_vector<float>();
+
+        Utils::unroll_times<2>([&](auto) __aie_inline {
+            const accum<accfloat, native_elems> twos(broadcast<float, native_elems>(2.0f));
+
+            r = mul(r, msc(twos, fb, r).template to_vector<float>()).template to_vector<float>();
+        });
+
+        vector<int32, native_elems> q   = zeros<int32, native_elems>();
+        vector<int32, native_elems> rem = na;
+
+        Utils::unroll_times<steps>([&](auto) __aie_inline {
+            q = add(q, to_fixed<int32>(mul(to_float<float>(rem, 0), r).template to_vector<float>(), 0));
+
+            accum<acc64, native_elems> acc;
+            acc.from_vector(na);
+            rem = msc(acc, q, nb).template to_vector<int32>();
+        });
+
+        // The estimate is within one of the truncated quotient of the magnitudes
+        q = select(q, sub(q, 1), lt(rem, 0));
+        q = select(q, add(q, 1), ge(rem, nb));
+
+        if constexpr (std::is_same_v<T, int32>)
+            q = select(q, add(q, 1), a_min);
+
+        q = select(q, neg(q),    lt(bit_xor(va, vb), T(0)));
+
+        if constexpr (std::is_same_v<T, int32>)
+            q = select(q, select(zeros<int32, native_elems>(), broadcast<int32, native_elems>(1), a_min), b_min);
+
+        vector<T, native_elems> tmp;
+
+        if constexpr (std::is_same_v<T, int16>)
+            tmp = q.template pack<int16>();
+        else
+            tmp = q;
+
+        if constexpr (Elems < native_elems)
+            ret = tmp.template extract<Elems>(0);
+        else
+            ret.insert(idx, tmp);
+    });
+
+    return ret;
+}
+
+/**
+ * @ingroup group_arithmetic
+ *
+ * Returns the quotients of the element-wise integer division of each value of the input vector by a scalar. Quotients
+ * are truncated towards zero, as in C++ integer division. See @ref div for the details of the implementation.
+ *
+ * @code
+ * for (unsigned i = 0; i < Elems; ++i)
+ *     out[i] = a[i] / b;
+ * @endcode
+ *
+ * @param a Vector of dividends. The type must meet @ref aie::RealVector.
+ * @param b Divisor. The type must meet @ref aie::RealElem.
+ */
+template <RealVector Vec, RealElem E>
+    requires(arch::is(arch::Gen2) && Utils::is_one_of_v<typename Vec::value_type, int16, int32> &&
+             std::is_integral_v<E>)
+__aie_inline
+auto div(const Vec &a, E b) -> vector<typename Vec::value_type, Vec::size()>
+{
+    using T = typename Vec::value_type;
+
+    return div(a, broadcast<T, Vec::size()>(T(b)));
+}
+
 /**
  * @ingroup group_arithmetic
  *
@@ -7874,6 +8633,17 @@ BINARY_OP_IMPL(Min)
 #include "aie_adf.hpp"
 #endif
 #include "operators.hpp"
+#include "cic.hpp"
+#include "correlation.hpp"
+#include "ddc.hpp"
+#include "spectral.hpp"
+#include "activation.hpp"
+#include "softmax.hpp"
+#include "norm.hpp"
+#include "top_k.hpp"
+#include "sort.hpp"
+#include "layout.hpp"
+#include "pack.hpp"
 
 #endif
 
@@ -724,7 +724,9 @@
  *
  * Tensor buffer streams are an abtraction provided by the AIE API to handle multi-dimensional addressing.
  *
- * \note Multi-dimensional addressing was introduced on AIE-ML/XDNA 1.
+ * \note Multi-dimensional addressing was introduced on AIE-ML/XDNA 1. On AIE, tensor buffer streams are also available and
+ *       the 2D and 3D address increments are emulated with scalar counters. Sliding window dimensions are not supported on
+ *       AIE.
  *
  * @subsubsection tensor_buffer_streams_description Tensor Descriptor
  *
@@ -845,6 +847,29 @@
  *
  * The exact increment values may also be set using aie::make_tensor_descriptor_from_native_bytes.
  *
+ * @subsubsection tensor_buffer_streams_circular Circular Tensor Buffer Streams
+ *
+ * aie::make_circular_tensor_buffer_stream creates a tensor buffer stream over a circular buffer. It takes the start of
+ * the buffer, which must meet the alignment requirements of a vector, its size and the initial position of the stream,
+ * all in elements. The size and the initial position must be multiples of the vector size. Addresses are wrapped into
+ * the buffer after every increment computed by the address generator, so a descriptor written for a linear buffer can
+ * walk a ring buffer without copying data. The absolute value of each increment must be smaller than the size of the
+ * buffer, and sliding window dimensions are not supported.
+ *
+ * @code
+ * // Frame buffer of 8 rows of 64 int16 values, read from the oldest row, at index head, in two vectors per row
+ * auto desc = aie::make_tensor_descriptor<int16, 32>(
+ *                      aie::tensor_dim(8u, 2),
+ *                      aie::tensor_dim(2u, 1));
+ *
+ * auto tbs = aie::make_circular_tensor_buffer_stream(frame, 8 * 64, head * 64, desc);
+ *
+ * for (unsigned i = 0; i < 8 * 2; ++i) {
+ *     aie::vector<int16, 32> v;
+ *     tbs >> v;
+ * }
+ * @endcode
+ *
  *
  * @subsection sparse_buffer_streams Sparse Vector Input Buffer Streams
  *
@@ -1388,6 +1413,21 @@
  *
  */
 
+/**
+ * @defgroup group_dsp Signal Processing Kernels
+ *
+ * Building blocks for signal processing chains implemented on top of the vector operations offered by the AIE API.
+ * Kernels that keep state across invocations are implemented as classes with a run member function that processes a
+ * block of samples, so a stream can be split across multiple kernel iterations.
+ */
+
+/**
+ * @defgroup group_nn Neural Network Kernels
+ *
+ * Building blocks for neural network layers implemented on top of the vector operations offered by the AIE API, such
+ * as activation functions.
+ */
+
 /**
  * @defgroup group_mul_special Special Multiplications
  *
@@ -277,6 +277,7 @@ template <unsigned NumReaders = 1, unsigned NumWriters = 1>
 using consumer_lock = detail::consumer_lock<NumReaders, NumWriters>;
 
 using adopt_lock_t  = detail::adopt_lock_t;
+using defer_lock_t  = detail::defer_lock_t;
 
 template <unsigned NumReaders = 1, unsigned NumWriters = 1>
 using producer_sem  = detail::producer_sem<NumReaders, NumWriters>;
@@ -287,10 +288,10 @@ using mutex         = detail::mutex;
 using detail::locked;
 
 template <typename Span, unsigned NumBuffers = 2, unsigned NumReaders = 1, unsigned NumWriters = 1>
-using buffered_input  = detail::sync::input<Span, NumBuffers>;
+using buffered_input  = detail::sync::input<Span, NumBuffers, NumReaders, NumWriters>;
 
 template <typename Span, unsigned NumBuffers = 2, unsigned NumReaders = 1, unsigned NumWriters = 1>
-using buffered_output = detail::sync::output<Span, NumBuffers>;
+using buffered_output = detail::sync::output<Span, NumBuffers, NumReaders, NumWriters>;
 
 }
 
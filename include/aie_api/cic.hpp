@@ -0,0 +1,414 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2025 Advanced Micro Devices, Inc.
+
+/**
+ * @file
+ * @brief Cascaded integrator-comb (CIC) decimation and interpolation filters.
+ */
+
+#pragma once
+
+#ifndef __AIE_API_CIC__HPP__
+#define __AIE_API_CIC__HPP__
+
+#include "aie.hpp"
+
+namespace aie::detail {
+
+template <unsigned Stages, unsigned Rate, unsigned DiffDelay, unsigned VectorSize>
+struct cic_base
+{
+    static constexpr unsigned vector_size = VectorSize;
+
+    using vector_type = vector<int32, vector_size>;
+    using accum_type  = accum<acc48, vector_size>;
+
+    __aie_inline
+    cic_base()
+    {
+        reset();
+    }
+
+    __aie_inline
+    void reset()
+    {
+        integrators_.fill(0);
+
+        for (auto &c : combs_)
+            c = aie::zeros<int32, vector_size>();
+    }
+
+    template <typename T>
+    __aie_inline
+    static vector_type widen(const vector<T, vector_size> &v)
+    {
+        if constexpr (std::is_same_v<T, int32>)
+            return v;
+        else
+            return v.template unpack<int32>();
+    }
+
+    // Runs all integrator stages on vector_size consecutive samples. Each integrator is the prefix sum of its input
+    // offset by the last output of the previous vector.
+    __aie_inline
+    vector_type integrate(vector_type v)
+    {
+        utils::unroll_times<Stages>([&](unsigned s) __aie_inline {
+            v = aie::add(aie::inclusive_scan(v), integrators_[s]);
+            integrators_[s] = v[vector_size - 1];
+        });
+
+        return v;
+    }
+
+    // Runs all comb stages on vector_size consecutive samples. The delayed samples of each comb are taken from the
+    // previous input vector of that stage.
+    __aie_inline
+    vector_type comb(vector_type v)
+    {
+        utils::unroll_times<Stages>([&](unsigned s) __aie_inline {
+            const vector_type delayed = aie::shuffle_up_fill(v, combs_[s], DiffDelay);
+            combs_[s] = v;
+            v = aie::sub(v, delayed);
+        });
+
+        return v;
+    }
+
+    template <typename Output>
+    __aie_inline
+    static vector<Output, vector_size> to_output(const vector_type &v, int shift)
+    {
+        const accum_type acc(v);
+
+        return acc.template to_vector<Output>(shift);
+    }
+
+    std::array<int32, Stages>       integrators_;
+    std::array<vector_type, Stages> combs_;
+};
+
+} // namespace aie::detail
+
+namespace aie {
+
+/**
+ * @ingroup group_dsp
+ *
+ * Cascaded integrator-comb (CIC) decimation filter with Stages integrator and comb sections and a decimation factor of
+ * Rate.
+ *
+ * Integrators run at the input rate and process a whole vector per step: each vector is turned into its prefix sum
+ * with @ref inclusive_scan, and then offset with the last output of the integrator on the previous vector.
+ * Comb sections run at the output rate on vectors of decimated samples. Filter state is kept across calls to @ref run,
+ * so a stream can be processed in blocks.
+ *
+ * Integrators and combs use 32b two's complement arithmetic. Wrap-around in the integrators is cancelled by the combs
+ * as long as the register width covers the filter gain, which is checked at compile time:
+ *
+ * @code
+ * input_bits + Stages * log2(Rate * DiffDelay) <= 32
+ * @endcode
+ *
+ * Comb outputs are moved to an %acc48 accumulator (%acc64 on AIE-ML/XDNA 1 and XDNA 2) to apply the output shift using
+ * the current rounding and saturation modes.
+ *
+ * @code
+ * aie::cic_decimator<4, 8, int16> cic; // 4 stages, decimation by 8
+ *
+ * cic.run(in, 1024, out);              // Writes 128 output samples
+ * @endcode
+ *
+ * @tparam Stages    Number of integrator and comb sections.
+ * @tparam Rate      Decimation factor. Must be a power of two.
+ * @tparam Input     Type of the input samples. Supported types are int16 and int32.
+ * @tparam Output    Type of the output samples, defaults to the input type.
+ * @tparam DiffDelay Differential delay of the comb sections. Must be 1 or 2.
+ */
+template <unsigned Stages, unsigned Rate, typename Input = int16, typename Output = Input, unsigned DiffDelay = 1>
+    requires(Stages > 0 && Rate > 1 && detail::utils::is_powerof2(Rate) && (DiffDelay == 1 || DiffDelay == 2) &&
+             Utils::is_one_of_v<Input, int16, int32> && Utils::is_one_of_v<Output, int16, int32>)
+class cic_decimator : private detail::cic_base<Stages, Rate, DiffDelay, 16>
+{
+    using base_type   = detail::cic_base<Stages, Rate, DiffDelay, 16>;
+    using vector_type = typename base_type::vector_type;
+
+public:
+    /**
+     * \brief Number of samples processed per vector operation.
+     */
+    static constexpr unsigned vector_size = base_type::vector_size;
+
+    /**
+     * \brief Number of bits of gain introduced by the filter, which is also the default output shift.
+     */
+    static constexpr unsigned gain_bits = Stages * detail::utils::log2(Rate * DiffDelay);
+
+    /**
+     * \brief Number of input samples that produce one output vector. The number of samples passed to @ref run must be
+     * a multiple of this value.
+     */
+    static constexpr unsigned block_size = vector_size * Rate;
+
+    static_assert(detail::type_bits_v<Input> + gain_bits <= 32, "Filter gain exceeds the 32b integrator width");
+
+    /**
+     * \brief Constructor. Filter state is initialized to zero.
+     *
+     * @param shift Downshift applied to the comb outputs. It defaults to the filter gain, which normalizes the output
+     *              to the input range.
+     */
+    __aie_inline
+    cic_decimator(int shift = gain_bits) : shift_(shift)
+    {}
+
+    /**
+     * \brief Sets integrator and comb state back to zero.
+     */
+    __aie_inline
+    void reset()
+    {
+        base_type::reset();
+    }
+
+    /**
+     * \brief Filters and decimates a block of samples.
+     *
+     * @param in  Input samples. Must meet the alignment requirements of a vector of vector_size elements.
+     * @param n   Number of input samples. Must be a multiple of block_size.
+     * @param out Output samples, n / Rate are written. Must meet the alignment requirements of a vector of vector_size
+     *            elements.
+     */
+    __aie_inline
+    void run(const Input * __restrict in, unsigned n, Output * __restrict out)
+    {
+        REQUIRES_MSG(n % block_size == 0, "Number of samples must be a multiple of block_size");
+
+#if !AIE_API_DISABLE_ALIGNMENT_ASSERTIONS
+        RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment<vector_size>(in),  "Insufficient input alignment");
+        RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment<vector_size>(out), "Insufficient output alignment");
+#endif
+
+        for (unsigned b = 0; b < n / block_size; ++b)
+            chess_loop_range(1,)
+        {
+            vector_type decimated;
+
+            if constexpr (Rate <= vector_size) {
+                constexpr unsigned out_per_vector = vector_size / Rate;
+
+                for (unsigned j = 0; j < Rate; ++j)
+                    chess_prepare_for_pipelining
+                    chess_loop_range(Rate, Rate)
+                {
+                    const vector_type v = this->integrate(base_type::widen(load_v<vector_size>(in)));
+                    in += vector_size;
+
+                    if constexpr (out_per_vector >= 4) {
+                        decimated.insert(j, select_phase<Rate>(v));
+                    }
+                    else {
+                        detail::utils::unroll_times<out_per_vector>([&](unsigned k) __aie_inline {
+                            decimated.set(v[k * Rate + Rate - 1], j * out_per_vector + k);
+                        });
+                    }
+                }
+            }
+            else {
+                constexpr unsigned vectors_per_output = Rate / vector_size;
+
+                for (unsigned k = 0; k < vector_size; ++k)
+                    chess_loop_range(vector_size, vector_size)
+                {
+                    vector_type v;
+
+                    for (unsigned j = 0; j < vectors_per_output; ++j)
+                        chess_prepare_for_pipelining
+                        chess_loop_range(vectors_per_output, vectors_per_output)
+                    {
+                        v = this->integrate(base_type::widen(load_v<vector_size>(in)));
+                        in += vector_size;
+                    }
+
+                    decimated.set(v[vector_size - 1], k);
+                }
+            }
+
+            store_v(out, base_type::template to_output<Output>(this->comb(decimated), shift_));
+            out += vector_size;
+        }
+    }
+
+private:
+    // Keeps the last sample of each group of R consecutive samples
+    template <unsigned R, unsigned Elems>
+    __aie_inline
+    static vector<int32, Elems / R> select_phase(const vector<int32, Elems> &v)
+    {
+        if constexpr (R == 1)
+            return v;
+        else
+            return select_phase<R / 2>(filter_odd(v, R / 2));
+    }
+
+    int shift_;
+};
+
+/**
+ * @ingroup group_dsp
+ *
+ * Cascaded integrator-comb (CIC) interpolation filter with Stages comb and integrator sections and an interpolation
+ * factor of Rate.
+ *
+ * Comb sections run at the input rate. Their output is upsampled by inserting Rate - 1 zeros after each sample, using
+ * interleave operations, and integrators run at the output rate processing a whole vector per step as described in
+ * @ref cic_decimator. Filter state is kept across calls to @ref run.
+ *
+ * The same 32b wrap-around arithmetic as in @ref cic_decimator is used, with the following compile-time requirement:
+ *
+ * @code
+ * input_bits + Stages * log2(Rate * DiffDelay) <= 32
+ * @endcode
+ *
+ * @tparam Stages    Number of comb and integrator sections.
+ * @tparam Rate      Interpolation factor. Must be a power of two.
+ * @tparam Input     Type of the input samples. Supported types are int16 and int32.
+ * @tparam Output    Type of the output samples, defaults to the input type.
+ * @tparam DiffDelay Differential delay of the comb sections. Must be 1 or 2.
+ */
+template <unsigned Stages, unsigned Rate, typename Input = int16, typename Output = Input, unsigned DiffDelay = 1>
+    requires(Stages > 0 && Rate > 1 && detail::utils::is_powerof2(Rate) && (DiffDelay == 1 || DiffDelay == 2) &&
+             Utils::is_one_of_v<Input, int16, int32> && Utils::is_one_of_v<Output, int16, int32>)
+class cic_interpolator : private detail::cic_base<Stages, Rate, DiffDelay, 16>
+{
+    using base_type   = detail::cic_base<Stages, Rate, DiffDelay, 16>;
+    using vector_type = typename base_type::vector_type;
+
+public:
+    /**
+     * \brief Number of samples processed per vector operation.
+     */
+    static constexpr unsigned vector_size = base_type::vector_size;
+
+    /**
+     * \brief Number of bits of gain introduced by the filter, which is also the default output shift.
+     */
+    static constexpr unsigned gain_bits = Stages * detail::utils::log2(Rate * DiffDelay) - detail::utils::log2(Rate);
+
+    /**
+     * \brief Number of input samples processed per step. The number of samples passed to @ref run must be a multiple
+     * of this value.
+     */
+    static constexpr unsigned block_size = vector_size;
+
+    static_assert(detail::type_bits_v<Input> + Stages * detail::utils::log2(Rate * DiffDelay) <= 32,
+                  "Filter gain exceeds the 32b integrator width");
+
+    /**
+     * \brief Constructor. Filter state is initialized to zero.
+     *
+     * @param shift Downshift applied to the integrator outputs. It defaults to the filter gain, which normalizes the
+     *              output to the input range.
+     */
+    __aie_inline
+    cic_interpolator(int shift = gain_bits) : shift_(shift)
+    {}
+
+    /**
+     * \brief Sets comb and integrator state back to zero.
+     */
+    __aie_inline
+    void reset()
+    {
+        base_type::reset();
+    }
+
+    /**
+     * \brief Filters and interpolates a block of samples.
+     *
+     * @param in  Input samples. Must meet the alignment requirements of a vector of vector_size elements.
+     * @param n   Number of input samples. Must be a multiple of block_size.
+     * @param out Output samples, n * Rate are written. Must meet the alignment requirements of a vector of vector_size
+     *            elements.
+     */
+    __aie_inline
+    void run(const Input * __restrict in, unsigned n, Output * __restrict out)
+    {
+        REQUIRES_MSG(n % block_size == 0, "Number of samples must be a multiple of block_size");
+
+#if !AIE_API_DISABLE_ALIGNMENT_ASSERTIONS
+        RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment<vector_size>(in),  "Insufficient input alignment");
+        RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment<vector_size>(out), "Insufficient output alignment");
+#endif
+
+        for (unsigned b = 0; b < n / block_size; ++b)
+            chess_loop_range(1,)
+        {
+            const vector_type v = this->comb(base_type::widen(load_v<vector_size>(in)));
+            in += vector_size;
+
+            if constexpr (Rate <= vector_size) {
+                const std::array<vector_type, Rate> upsampled = zero_stuff<Rate>(v);
+
+                detail::utils::unroll_times<Rate>([&](unsigned j) __aie_inline {
+                    store_v(out, base_type::template to_output<Output>(this->integrate(upsampled[j]), shift_));
+                    out += vector_size;
+                });
+            }
+            else {
+                constexpr unsigned vectors_per_input = Rate / vector_size;
+
+                for (unsigned k = 0; k < vector_size; ++k)
+                    chess_loop_range(vector_size, vector_size)
+                {
+                    vector_type impulse = zeros<int32, vector_size>();
+                    impulse.set(v[k], 0);
+
+                    store_v(out, base_type::template to_output<Output>(this->integrate(impulse), shift_));
+                    out += vector_size;
+
+                    for (unsigned j = 1; j < vectors_per_input; ++j)
+                        chess_prepare_for_pipelining
+                        chess_loop_range(vectors_per_input - 1, vectors_per_input - 1)
+                    {
+                        store_v(out, base_type::template to_output<Output>(this->integrate(zeros<int32, vector_size>()), shift_));
+                        out += vector_size;
+                    }
+                }
+            }
+        }
+    }
+
+private:
+    // Inserts R - 1 zeros after each element. Upsampling by R is computed as log2(R) upsamplings by 2, each of them
+    // implemented with an interleave with a zero vector.
+    template <unsigned R>
+    __aie_inline
+    static std::array<vector_type, R> zero_stuff(const vector_type &v)
+    {
+        if constexpr (R == 1) {
+            return {v};
+        }
+        else {
+            const auto [lo, hi] = interleave_zip(v, zeros<int32, vector_size>(), 1);
+            const std::array<vector_type, R / 2> a = zero_stuff<R / 2>(lo);
+            const std::array<vector_type, R / 2> b = zero_stuff<R / 2>(hi);
+
+            std::array<vector_type, R> ret;
+
+            detail::utils::unroll_times<R / 2>([&](unsigned i) __aie_inline {
+                ret[i]         = a[i];
+                ret[R / 2 + i] = b[i];
+            });
+
+            return ret;
+        }
+    }
+
+    int shift_;
+};
+
+} // namespace aie
+
+#endif
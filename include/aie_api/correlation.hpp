@@ -0,0 +1,246 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2025 Advanced Micro Devices, Inc.
+
+/**
+ * @file
+ * @brief Cross-correlation and autocorrelation kernels.
+ */
+
+#pragma once
+
+#ifndef __AIE_API_CORRELATION__HPP__
+#define __AIE_API_CORRELATION__HPP__
+
+#include "aie.hpp"
+
+namespace aie::detail {
+
+template <typename T>
+struct correlation_traits;
+
+template <>
+struct correlation_traits<cint16>
+{
+#if __AIE_ARCH__ == 10
+    static constexpr unsigned lanes = 8;
+#else
+    static constexpr unsigned lanes = 16;
+#endif
+    using accum_tag = cacc48;
+    using magnitude_type = int32;
+};
+
+template <>
+struct correlation_traits<cfloat>
+{
+    static constexpr unsigned lanes = 4;
+    using accum_tag = caccfloat;
+    using magnitude_type = float;
+};
+
+template <typename T>
+struct correlation_peak_impl
+{
+    unsigned index;
+    typename correlation_traits<T>::magnitude_type magnitude_square;
+};
+
+template <typename T>
+__aie_inline
+correlation_peak_impl<T> correlate(const T * __restrict x, const T * __restrict ref, unsigned ref_len, unsigned num_lags,
+                                   T * __restrict out, int shift, bool skip_zero_lag)
+{
+    using traits = correlation_traits<T>;
+    using accum_tag = typename traits::accum_tag;
+    using magnitude_type = typename traits::magnitude_type;
+
+    constexpr unsigned Lanes = traits::lanes;
+
+    // Each call computes Lanes lags over Lanes reference samples. Data and reference advance by a whole vector per
+    // iteration so all loads are aligned.
+    using mul_ops = aie::sliding_mul_ops<Lanes, Lanes, 1, 1, 1, T, T, accum_tag>;
+
+    REQUIRES_MSG(ref_len  % Lanes == 0, "Reference length must be a multiple of the number of lanes");
+    REQUIRES_MSG(num_lags % Lanes == 0, "Number of lags must be a multiple of the number of lanes");
+
+#if !AIE_API_DISABLE_ALIGNMENT_ASSERTIONS
+    RUNTIME_ASSERT_NO_ASSUME(check_vector_alignment<Lanes>(x),   "Insufficient input alignment");
+    RUNTIME_ASSERT_NO_ASSUME(check_vector_alignment<Lanes>(ref), "Insufficient reference alignment");
+    RUNTIME_ASSERT_NO_ASSUME(check_vector_alignment<Lanes>(out), "Insufficient output alignment");
+#endif
+
+    vector<magnitude_type, Lanes> best = aie::zeros<magnitude_type, Lanes>();
+    vector<int32, Lanes> idx;
+
+    utils::unroll_times<Lanes>([&](unsigned i) __aie_inline {
+        idx.set(i, i);
+    });
+
+    vector<int32, Lanes> best_idx = idx;
+
+    for (unsigned b = 0; b < num_lags / Lanes; ++b)
+        chess_loop_range(1,)
+    {
+        const T * __restrict px = x + b * Lanes;
+        const T * __restrict ph = ref;
+
+        accum<accum_tag, Lanes> acc = aie::zeros<accum_tag, Lanes>();
+
+        for (unsigned n = 0; n < ref_len / Lanes; ++n)
+            chess_prepare_for_pipelining
+            chess_loop_range(1,)
+        {
+            const vector<T, Lanes> coeff = aie::load_v<Lanes>(ph);
+            ph += Lanes;
+
+            const vector<T, 2 * Lanes> data = aie::concat(aie::load_v<Lanes>(px), aie::load_v<Lanes>(px + Lanes));
+            px += Lanes;
+
+            acc = mul_ops::mac(acc, aie::op_conj(coeff), 0, data, 0);
+        }
+
+        const vector<T, Lanes> lags = acc.template to_vector<T>(shift);
+        aie::store_v(out, lags);
+        out += Lanes;
+
+        vector<magnitude_type, Lanes> mag;
+
+        // Integer magnitudes are computed in a 48b accumulator and halved, so saturated lags such as (-32768, -32768),
+        // whose squared magnitude is 2^31, do not overflow
+        if constexpr (is_floating_point_v<T>)
+            mag = aie::abs_square(lags);
+        else
+            mag = aie::mac_square(aie::mul_square<acc48>(aie::real(lags)), aie::imag(lags)).template to_vector<int32>(1);
+
+        if (skip_zero_lag && b == 0)
+            mag.set(0, 0);
+
+        const auto [new_best, m] = aie::max_cmp(best, mag);
+        best     = new_best;
+        best_idx = aie::select(best_idx, idx, m);
+        idx      = aie::add(idx, (int32)Lanes);
+    }
+
+    correlation_peak_impl<T> ret{(unsigned)best_idx[0], best[0]};
+
+    for (unsigned i = 1; i < Lanes; ++i) {
+        const magnitude_type m = best[i];
+        const unsigned       l = best_idx[i];
+
+        if (m > ret.magnitude_square || (m == ret.magnitude_square && l < ret.index))
+            ret = {l, m};
+    }
+
+    return ret;
+}
+
+} // namespace aie::detail
+
+namespace aie {
+
+/**
+ * @ingroup group_dsp
+ *
+ * Location and squared magnitude of the largest correlation lag. For cint16 samples the squared magnitude is halved, so
+ * that it fits in an int32 value for any lag.
+ *
+ * @tparam T Type of the correlated samples.
+ */
+template <typename T>
+using correlation_peak = detail::correlation_peak_impl<T>;
+
+/**
+ * @ingroup group_dsp
+ *
+ * Number of lags computed per vector operation by @ref xcorr and @ref autocorr. Lag counts and reference lengths must
+ * be multiples of this value.
+ *
+ * @tparam T Type of the correlated samples.
+ */
+template <typename T>
+static constexpr unsigned correlation_lanes_v = detail::correlation_traits<T>::lanes;
+
+/**
+ * @ingroup group_dsp
+ *
+ * Computes a block of lags of the cross-correlation between an input signal and a reference sequence.
+ *
+ * @code
+ * for (unsigned k = 0; k < num_lags; ++k)
+ *     out[k] = sum(x[n + k] * conj(ref[n]) for n in [0, ref_len));
+ * @endcode
+ *
+ * Lags are computed correlation_lanes_v<T> at a time with sliding multiplications in which the reference samples act
+ * as conjugated coefficients, so each reference vector is loaded once per block of lags. The squared magnitude of each
+ * lag is tracked lane-wise while the results are written, and the strongest lag is returned.
+ *
+ * @code
+ * // Search a 64-sample preamble over 256 candidate offsets
+ * auto peak = aie::xcorr(rx, preamble, 64, 256, lags, 15);
+ *
+ * if (peak.magnitude_square > threshold)
+ *     sync_offset = peak.index;
+ * @endcode
+ *
+ * \note
+ * cfloat correlation is only supported on AIE.
+ *
+ * @param x        Input signal. It must hold at least ref_len + num_lags samples and meet the alignment requirements of
+ *                 a vector of correlation_lanes_v<T> elements.
+ * @param ref      Reference sequence. Must meet the alignment requirements of a vector of correlation_lanes_v<T>
+ *                 elements.
+ * @param ref_len  Number of reference samples. Must be a multiple of correlation_lanes_v<T>.
+ * @param num_lags Number of lags to compute. Must be a multiple of correlation_lanes_v<T>.
+ * @param out      Output buffer for num_lags correlation values. Must meet the alignment requirements of a vector of
+ *                 correlation_lanes_v<T> elements.
+ * @param shift    Downshift applied to the accumulated lags before they are stored. Ignored for floating-point types.
+ *
+ * @return Index and squared magnitude of the largest lag. Ties are resolved in favour of the smallest lag.
+ */
+template <ElemBaseType T>
+    requires(std::is_same_v<T, cint16> || (std::is_same_v<T, cfloat> && arch::is(arch::AIE)))
+__aie_inline
+correlation_peak<T> xcorr(const T * __restrict x, const T * __restrict ref, unsigned ref_len, unsigned num_lags,
+                          T * __restrict out, int shift = 0)
+{
+    return detail::correlate(x, ref, ref_len, num_lags, out, shift, false);
+}
+
+/**
+ * @ingroup group_dsp
+ *
+ * Computes a block of lags of the autocorrelation of an input signal over a window of n samples.
+ *
+ * @code
+ * for (unsigned k = 0; k < num_lags; ++k)
+ *     out[k] = sum(x[i + k] * conj(x[i]) for i in [0, n));
+ * @endcode
+ *
+ * It uses the same lag batching as @ref xcorr. Since lag 0 always holds the energy of the window, it is excluded from
+ * the peak search so the returned peak reflects the strongest periodicity of the signal.
+ *
+ * \note
+ * cfloat correlation is only supported on AIE.
+ *
+ * @param x        Input signal. It must hold at least n + num_lags samples and meet the alignment requirements of a
+ *                 vector of correlation_lanes_v<T> elements.
+ * @param n        Window length. Must be a multiple of correlation_lanes_v<T>.
+ * @param num_lags Number of lags to compute. Must be a multiple of correlation_lanes_v<T>.
+ * @param out      Output buffer for num_lags correlation values. Must meet the alignment requirements of a vector of
+ *                 correlation_lanes_v<T> elements.
+ * @param shift    Downshift applied to the accumulated lags before they are stored. Ignored for floating-point types.
+ *
+ * @return Index and squared magnitude of the largest lag other than lag 0.
+ */
+template <ElemBaseType T>
+    requires(std::is_same_v<T, cint16> || (std::is_same_v<T, cfloat> && arch::is(arch::AIE)))
+__aie_inline
+correlation_peak<T> autocorr(const T * __restrict x, unsigned n, unsigned num_lags, T * __restrict out, int shift = 0)
+{
+    return detail::correlate(x, x, n, num_lags, out, shift, true);
+}
+
+} // namespace aie
+
+#endif
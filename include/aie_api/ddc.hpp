@@ -0,0 +1,239 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2025 Advanced Micro Devices, Inc.
+
+/**
+ * @file
+ * @brief Digital down-converter kernel.
+ */
+
+#pragma once
+
+#ifndef __AIE_API_DDC__HPP__
+#define __AIE_API_DDC__HPP__
+
+#include "aie.hpp"
+
+namespace aie::detail {
+
+static constexpr float ddc_phase_to_radians = 6.28318530718f / 4294967296.0f;
+
+inline cint16 ddc_phasor(uint32 phase)
+{
+    const float angle = float(phase) * ddc_phase_to_radians;
+
+    return cint16{(int16)(32767.0f * std::cos(angle)), (int16)(32767.0f * std::sin(angle))};
+}
+
+} // namespace aie::detail
+
+namespace aie {
+
+/**
+ * @ingroup group_dsp
+ *
+ * Digital down-converter. Mixes a complex input signal with a numerically controlled oscillator (NCO) and decimates the
+ * result with a polyphase FIR filter, without storing the mixed signal in memory.
+ *
+ * @code
+ * z[n] = x[n] * exp(-j * (phase + n * phase_inc) * 2 * pi / 2^32);
+ * y[m] = sum(h[t] * z[m * Rate - t] for t in [0, Taps));
+ * @endcode
+ *
+ * The NCO is a 32b phase accumulator. Phasors are generated for a whole vector of samples by recursive rotation: the
+ * phasors of the next vector are obtained by multiplying the current ones by a constant phasor. The rotation is
+ * re-anchored to the exact value of the phase accumulator at the beginning of each block of block_size samples, so
+ * amplitude and phase errors do not build up with the number of samples: the error of each phasor is bounded by about
+ * 2 * Rate LSBs of the Q.15 format, whatever the length of the input. Phasors are applied with a conjugated
+ * multiplication (op_conj).
+ *
+ * Mixed samples are split into Rate phases with interleave operations, and each phase is filtered with its Taps / Rate
+ * subfilter using sliding multiplications that accumulate into the same result.
+ *
+ * @code
+ * aie::ddc<32, 4> ddc(taps, phase_inc);  // 32 taps, decimation by 4
+ *
+ * ddc.run(in, 512, out);                 // Writes 128 output samples
+ * @endcode
+ *
+ * @tparam Taps Number of filter taps. Must be a multiple of Rate.
+ * @tparam Rate Decimation factor. Must be a power of two.
+ */
+template <unsigned Taps, unsigned Rate>
+    requires(Rate > 1 && detail::utils::is_powerof2(Rate) && Taps % Rate == 0)
+class ddc
+{
+public:
+    /**
+     * \brief Number of output samples computed per step.
+     */
+    static constexpr unsigned lanes = arch::is(arch::AIE)? 8 : 16;
+
+    /**
+     * \brief Number of input samples that produce one output vector. The number of samples passed to @ref run must be
+     * a multiple of this value.
+     */
+    static constexpr unsigned block_size = lanes * Rate;
+
+private:
+    static constexpr unsigned phase_taps = Taps / Rate;
+    static constexpr unsigned points     = ((phase_taps + 3) / 4) * 4;
+
+    static_assert(points <= lanes, "Too many taps per polyphase branch");
+
+    using vector_type = vector<cint16, lanes>;
+    using coeff_type  = vector<int16, 16>;
+    using accum_tag   = cacc48;
+    using mul_ops     = sliding_mul_ops<lanes, points, 1, 1, 1, int16, cint16, accum_tag>;
+
+public:
+    /**
+     * \brief Constructor. Filter state is initialized to zero.
+     *
+     * @param taps      Filter taps in Q.15 format.
+     * @param phase_inc NCO phase increment per input sample. A full turn corresponds to 2^32.
+     * @param shift     Downshift applied to the filter outputs.
+     * @param phase     Initial NCO phase.
+     */
+    ddc(const int16 *taps, uint32 phase_inc, int shift = 15, uint32 phase = 0) :
+        phase_(phase), phase_inc_(phase_inc), shift_(shift)
+    {
+        for (unsigned p = 0; p < Rate; ++p) {
+            coeff_type c = zeros<int16, 16>();
+
+            // Subfilter taps are stored in reverse order, right-aligned to the number of points
+            for (unsigned i = points - phase_taps; i < points; ++i)
+                c.set(taps[(points - 1 - i) * Rate + p], i);
+
+            coeff_[p] = c;
+        }
+
+        for (unsigned i = 0; i < lanes; ++i)
+            lane_offsets_.set(detail::ddc_phasor(i * phase_inc), i);
+
+        rotation_ = detail::ddc_phasor(lanes * phase_inc);
+
+        reset();
+    }
+
+    /**
+     * \brief Clears the filter state. The NCO phase is not modified.
+     */
+    __aie_inline
+    void reset()
+    {
+        for (auto &h : history_)
+            h = zeros<cint16, lanes>();
+    }
+
+    /**
+     * \brief Down-converts a block of samples.
+     *
+     * @param in  Input samples. Must meet the alignment requirements of a vector of lanes elements.
+     * @param n   Number of input samples. Must be a multiple of block_size.
+     * @param out Output samples, n / Rate are written. Must meet the alignment requirements of a vector of lanes
+     *            elements.
+     */
+    __aie_inline
+    void run(const cint16 * __restrict in, unsigned n, cint16 * __restrict out)
+    {
+        REQUIRES_MSG(n % block_size == 0, "Number of samples must be a multiple of block_size");
+
+#if !AIE_API_DISABLE_ALIGNMENT_ASSERTIONS
+        RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment<lanes>(in),  "Insufficient input alignment");
+        RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment<lanes>(out), "Insufficient output alignment");
+#endif
+
+        uint32 block_phase = phase_;
+
+        for (unsigned b = 0; b < n / block_size; ++b)
+            chess_prepare_for_pipelining
+            chess_loop_range(1,)
+        {
+            std::array<vector_type, Rate> mixed;
+
+            // Re-anchored to the phase accumulator at every block, so rounding errors only build up over Rate rotations
+            vector_type phasor = mul(lane_offsets_, detail::ddc_phasor(block_phase)).template to_vector<cint16>(15);
+            block_phase += block_size * phase_inc_;
+
+            detail::utils::unroll_times<Rate>([&](unsigned j) __aie_inline {
+                mixed[j] = mul(load_v<lanes>(in), op_conj(phasor)).template to_vector<cint16>(15);
+                in += lanes;
+
+                phasor = mul(phasor, rotation_).template to_vector<cint16>(15);
+            });
+
+            const std::array<vector_type, Rate> phases = deinterleave<Rate>(mixed);
+
+            // Phase p of the filter is applied to the samples x[k * Rate - p]. For p > 0 these come from stream
+            // Rate - p delayed by one sample.
+            accum<accum_tag, lanes> acc = mul_ops::mul(coeff_[0], 0, concat(history_[0], phases[0]),
+                                                       lanes - points + 1);
+
+            detail::utils::unroll_times<Rate - 1>([&](unsigned idx) __aie_inline {
+                const unsigned p = idx + 1;
+
+                acc = mul_ops::mac(acc, coeff_[p], 0, concat(history_[Rate - p], phases[Rate - p]),
+                                   lanes - points);
+            });
+
+            history_ = phases;
+
+            store_v(out, acc.template to_vector<cint16>(shift_));
+            out += lanes;
+        }
+
+        phase_ += n * phase_inc_;
+    }
+
+    /**
+     * \brief Returns the current NCO phase.
+     */
+    uint32 phase() const
+    {
+        return phase_;
+    }
+
+private:
+    // Splits Rate consecutive vectors into Rate streams, where stream q holds the samples with index k * Rate + q.
+    // Each level of the recursion separates even and odd samples.
+    template <unsigned R>
+    __aie_inline
+    static std::array<vector_type, R> deinterleave(const std::array<vector_type, R> &z)
+    {
+        if constexpr (R == 1) {
+            return z;
+        }
+        else {
+            std::array<vector_type, R / 2> even, odd;
+
+            detail::utils::unroll_times<R / 2>([&](unsigned i) __aie_inline {
+                std::tie(even[i], odd[i]) = interleave_unzip(z[2 * i], z[2 * i + 1], 1);
+            });
+
+            const std::array<vector_type, R / 2> e = deinterleave<R / 2>(even);
+            const std::array<vector_type, R / 2> o = deinterleave<R / 2>(odd);
+
+            std::array<vector_type, R> ret;
+
+            detail::utils::unroll_times<R / 2>([&](unsigned q) __aie_inline {
+                ret[2 * q]     = e[q];
+                ret[2 * q + 1] = o[q];
+            });
+
+            return ret;
+        }
+    }
+
+    std::array<coeff_type, Rate>  coeff_;
+    std::array<vector_type, Rate> history_;
+    vector_type                   lane_offsets_;
+    cint16                        rotation_;
+    uint32                        phase_;
+    uint32                        phase_inc_;
+    int                           shift_;
+};
+
+} // namespace aie
+
+#endif
@@ -7,6 +7,7 @@
 #ifndef __AIE_API_DETAIL_AIE1_ELEMENTARY__HPP__
 #define __AIE_API_DETAIL_AIE1_ELEMENTARY__HPP__
 
+#include "../shift.hpp"
 #include "../vector.hpp"
 
 // TODO: Temporary workaround as these are not properly defined. Remove once they are added to compiler headers.
@@ -372,6 +373,22 @@ struct elementary_vector_bits_impl<ElementaryOp::Cos, 32, float, float, N>
     }
 };
 
+// int16 inputs are Q1.15 scaled by 1/Pi, as on AIE-ML and XDNA 2, so they are moved to the upper half of the 32b phase
+template <ElementaryOp Op, typename TR, unsigned N>
+    requires(Op == ElementaryOp::Sin || Op == ElementaryOp::Cos || Op == ElementaryOp::SinCos || Op == ElementaryOp::SinCosComplex)
+struct elementary_vector_bits_impl<Op, 16, TR, int16, N>
+{
+    using vector_type = vector<int16, N>;
+
+    __aie_inline
+    static auto run(const vector_type &v, int shift_dummy = 0, bool sign_dummy = false)
+    {
+        const vector<int32, N> phase = shift<int32, N>::run(v.template unpack<int32>(), 16, 0);
+
+        return elementary_vector<Op, TR, int32, N>::run(phase);
+    }
+};
+
 template <unsigned N, typename TR>
 struct elementary_vector_bits_impl<ElementaryOp::SinCos, 32, TR, int32, N>
 {
@@ -333,6 +333,106 @@ private:
     [[no_unique_address]] iterator_stride<Stride> stride_;
 };
 
+// Read-only iterator for 256b and 512b vectors. The offset of the pointer within a 256b chunk does not change during
+// the traversal, so each vector is built with a single shift from the last chunk of the previous vector, which is kept
+// in registers, and the chunks that hold the current vector. Incrementing the iterator reloads that chunk from the same
+// address used by the dereference, which the compiler folds into a single load when the iterator is dereferenced once
+// per step. Only chunks that hold elements of the current vector are loaded, so the iterator never reads past the
+// buffer: for aligned pointers the kept chunk is shifted out completely.
+template <typename T, unsigned Elems, aie_dm_resource Resource>
+    requires(std::is_const_v<T> && type_bits_v<T> >= 8 && (type_bits_v<T> * Elems == 256 || type_bits_v<T> * Elems == 512))
+class unaligned_vector_iterator<T, Elems, Resource> property(keep_in_registers)
+{
+public:
+    using         elem_type = aie_dm_resource_remove_t<T>;
+    using       vector_type = vector<std::remove_const_t<elem_type>, Elems>;
+
+    using        value_type = vector_type;
+    using         reference = vector_type;
+    using           pointer = const value_type *;
+    using iterator_category = std::forward_iterator_tag;
+    using   difference_type = ptrdiff_t;
+
+    __aie_inline
+    constexpr unaligned_vector_iterator(T *ptr) :
+        ptr_(ptr),
+        shift_(((uintptr_t(ptr) - 1) & 31) + 1)
+    {
+        RUNTIME_ASSERT(ptr_ != nullptr, "Iterator cannot be created from nullptr");
+
+        // For unaligned pointers the first chunk also holds elements of the vector that ends at ptr, so it can be
+        // loaded even for end iterators
+        if (shift_ != 32)
+            prev_ = load_chunk(utils::floor_ptr<chunk_elems>(ptr_));
+    }
+
+    __aie_inline
+    constexpr unaligned_vector_iterator &operator++()
+    {
+        prev_ = load_chunk(last_chunk());
+        ptr_ += Elems;
+        return *this;
+    }
+
+    __aie_inline
+    constexpr unaligned_vector_iterator  operator++(int)
+    {
+        unaligned_vector_iterator it = *this;
+        ++(*this);
+        return it;
+    }
+
+    __aie_inline
+    constexpr vector_type operator*() const
+    {
+        const wide_type lo = concat_vector(prev_, load_chunk(last_chunk() - (num_chunks - 1) * chunk_elems));
+        wide_type hi;
+
+        if constexpr (num_chunks == 2)
+            hi.insert(0, load_chunk(last_chunk()));
+
+        const wide_type ret = SHIFT_BYTES(lo, hi, shift_);
+
+        if constexpr (num_chunks == 2)
+            return ret;
+        else
+            return ret.template extract<Elems>(0);
+    }
+
+    constexpr bool operator==(const unaligned_vector_iterator &rhs) const { return ptr_ == rhs.ptr_; }
+    constexpr bool operator!=(const unaligned_vector_iterator &rhs) const { return ptr_ != rhs.ptr_; }
+
+private:
+    static constexpr unsigned chunk_elems = 256 / type_bits_v<T>;
+    static constexpr unsigned  num_chunks = Elems / chunk_elems;
+
+    using chunk_type = vector<std::remove_const_t<elem_type>, chunk_elems>;
+    using  wide_type = vector<std::remove_const_t<elem_type>, 2 * chunk_elems>;
+
+    // Chunk that holds the last element of the current vector
+    __aie_inline
+    constexpr T *last_chunk() const
+    {
+        return utils::floor_ptr<chunk_elems>(ptr_ + Elems - 1);
+    }
+
+    __aie_inline
+    static constexpr chunk_type load_chunk(T *ptr)
+    {
+        chunk_type ret;
+
+        ret.template load<Resource>(ptr);
+
+        return ret;
+    }
+
+    T *ptr_;
+    // Offset of the vector from the start of the kept chunk, in bytes. Aligned pointers use an offset of 32, since the
+    // kept chunk is the one before the vector
+    unsigned shift_;
+    chunk_type prev_;
+};
+
 template <unsigned VectorBits>
 struct sparse_vector_fill_index {};
 
@@ -551,4 +551,7 @@ struct elementary_bits_impl<ElementaryOp::InvSqrt, TypeBits, bfloat16, bfloat16>
 
 }
 
+#include "elementary_sincos.hpp"
+#include "elementary_atan2.hpp"
+
 #endif
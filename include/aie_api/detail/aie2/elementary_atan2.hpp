@@ -0,0 +1,250 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2025 Advanced Micro Devices, Inc.
+
+#pragma once
+
+#ifndef __AIE_API_DETAIL_AIE2_ELEMENTARY_ATAN2__HPP__
+#define __AIE_API_DETAIL_AIE2_ELEMENTARY_ATAN2__HPP__
+
+#include "../abs.hpp"
+#include "../add.hpp"
+#include "../blend.hpp"
+#include "../broadcast.hpp"
+#include "../compare.hpp"
+#include "../interleave.hpp"
+#include "../max_min.hpp"
+#include "../mul.hpp"
+#include "../neg.hpp"
+#include "../vector.hpp"
+
+namespace aie::detail {
+
+// Floating-point kernels shared by atan2, arg and the magnitude of complex vectors. Reciprocals and reciprocal square
+// roots start from the bfloat16 implementations, which are vectorized on AIE-ML and XDNA 2, and are refined to float
+// precision with two Newton-Raphson steps.
+struct polar_float
+{
+    static constexpr unsigned native_elems = 16;
+
+    using vector_type = vector<float, native_elems>;
+
+    // atan2(y, x) in radians. The ratio of the smaller and larger magnitudes is reduced to [-tan(Pi/8), tan(Pi/8)],
+    // where atan is evaluated with a degree 9 polynomial whose error is below the float precision. Results are then
+    // reflected into the right octant.
+    __aie_inline
+    static vector_type atan2(const vector_type &y, const vector_type &x)
+    {
+        const vector_type ax = abs<float, native_elems>::run(x);
+        const vector_type ay = abs<float, native_elems>::run(y);
+        const vector_type mn = min<float, native_elems>::run(ax, ay);
+        const vector_type mx = max<float, native_elems>::run(ax, ay);
+
+        // atan(t) = Pi/4 + atan((t - 1) / (t + 1)) for t > tan(Pi/8). The reduction is folded into the numerator and
+        // the denominator, so a single reciprocal is computed.
+        const mask<native_elems> big = lt<float, native_elems>::run(multiply(mx, broadcast<float, native_elems>::run(0.414213562f)), mn);
+
+        const vector_type num = select<float, native_elems>::run(mn, sub<float, native_elems>::run(mn, mx), big);
+        const vector_type den = select<float, native_elems>::run(mx, add<float, native_elems>::run(mn, mx), big);
+
+        const vector_type t = multiply(num, inv(den));
+        const vector_type z = multiply(t, t);
+
+        vector_type p = mul_add(z, broadcast<float, native_elems>::run(8.05374449538e-2f), -1.38776856032e-1f);
+        p = mul_add(p, z,  1.99777106478e-1f);
+        p = mul_add(p, z, -3.33329491539e-1f);
+        p = multiply(p, z);
+
+        // t + t * z * p(z)
+        const accum<accfloat, native_elems> acc_t(t);
+        vector_type r = mul<MulMacroOp::Add_Mul, 32, float, float>::run(p, true, t, true, acc_t).template to_vector<float>();
+
+        r = select<float, native_elems>::run(r, add<float, native_elems>::run(r, broadcast<float, native_elems>::run(0.785398163f)), big);
+        r = select<float, native_elems>::run(r, sub<float, native_elems>::run(broadcast<float, native_elems>::run(1.57079633f), r),
+                                             lt<float, native_elems>::run(ax, ay));
+        r = select<float, native_elems>::run(r, sub<float, native_elems>::run(broadcast<float, native_elems>::run(3.14159265f), r),
+                                             lt<float, native_elems>::run(x, 0.0f));
+        r = select<float, native_elems>::run(r, neg<float, native_elems>::run(r), lt<float, native_elems>::run(y, 0.0f));
+
+        // atan2(0, 0) returns 0
+        return select<float, native_elems>::run(r, broadcast<float, native_elems>::run(0.0f), eq<float, native_elems>::run(mx, 0.0f));
+    }
+
+    // sqrt(x * x + y * y), computed as s * invsqrt(s)
+    __aie_inline
+    static vector_type hypot(const vector_type &y, const vector_type &x)
+    {
+        const vector_type s = mul_add(y, y, multiply(x, x));
+
+        // r = r * (1.5 - 0.5 * s * r^2)
+        vector_type r = to_float(elementary_vector<ElementaryOp::InvSqrt, bfloat16, bfloat16, native_elems>::run(to_bfloat16(s)));
+        const vector_type half_s = multiply(s, broadcast<float, native_elems>::run(0.5f));
+
+        for (unsigned i = 0; i < 2; ++i) {
+            const accum<accfloat, native_elems> acc(broadcast<float, native_elems>::run(1.5f));
+            const vector_type r2 = multiply(r, r);
+
+            r = multiply(r, mul<MulMacroOp::Sub_Mul, 32, float, float>::run(half_s, true, r2, true, acc).template to_vector<float>());
+        }
+
+        return select<float, native_elems>::run(multiply(s, r), broadcast<float, native_elems>::run(0.0f),
+                                                eq<float, native_elems>::run(s, 0.0f));
+    }
+
+private:
+    // r = r * (2 - v * r)
+    __aie_inline
+    static vector_type inv(const vector_type &v)
+    {
+        vector_type r = to_float(elementary_vector<ElementaryOp::Inv, bfloat16, bfloat16, native_elems>::run(to_bfloat16(v)));
+
+        for (unsigned i = 0; i < 2; ++i) {
+            const accum<accfloat, native_elems> acc(broadcast<float, native_elems>::run(2.0f));
+
+            r = multiply(r, mul<MulMacroOp::Sub_Mul, 32, float, float>::run(v, true, r, true, acc).template to_vector<float>());
+        }
+
+        return r;
+    }
+
+    __aie_inline
+    static vector<bfloat16, native_elems> to_bfloat16(const vector_type &v)
+    {
+        return accum<accfloat, native_elems>(v).template to_vector<bfloat16>();
+    }
+
+    __aie_inline
+    static vector_type to_float(const vector<bfloat16, native_elems> &v)
+    {
+        return mul<MulMacroOp::Mul, 32, bfloat16, bfloat16>::run(v, true, broadcast<bfloat16, native_elems>::run(1.0f), true).template to_vector<float>();
+    }
+
+    __aie_inline
+    static vector_type multiply(const vector_type &a, const vector_type &b)
+    {
+        return mul<MulMacroOp::Mul, 32, float, float>::run(a, true, b, true).template to_vector<float>();
+    }
+
+    // Computes a * b + c
+    __aie_inline
+    static vector_type mul_add(const vector_type &a, const vector_type &b, const vector_type &c)
+    {
+        const accum<accfloat, native_elems> acc(c);
+
+        return mul<MulMacroOp::Add_Mul, 32, float, float>::run(a, true, b, true, acc).template to_vector<float>();
+    }
+
+    __aie_inline
+    static vector_type mul_add(const vector_type &a, const vector_type &b, float c)
+    {
+        return mul_add(a, b, broadcast<float, native_elems>::run(c));
+    }
+};
+
+template <unsigned N>
+struct atan2_vector
+{
+    static constexpr unsigned native_elems = polar_float::native_elems;
+    static constexpr unsigned num_op       = N < native_elems? 1 : N / native_elems;
+
+    using vector_type = vector<float, N>;
+
+    __aie_inline
+    static vector_type run(const vector_type &y, const vector_type &x)
+    {
+        vector_type ret;
+
+        utils::unroll_times<num_op>([&](auto idx) __aie_inline {
+            const vector<float, native_elems> tmp = polar_float::atan2(y.template grow_extract<native_elems>(idx),
+                                                                       x.template grow_extract<native_elems>(idx));
+
+            if constexpr (N < native_elems)
+                ret = tmp.template extract<N>(0);
+            else
+                ret.insert(idx, tmp);
+        });
+
+        return ret;
+    }
+};
+
+enum class PolarOp {
+    Arg,
+    Abs
+};
+
+// Phase and magnitude of complex vectors. Components are deinterleaved and converted to float for the computation.
+// Phases of cint16 and cint32 vectors are returned in Q1.15 and Q1.31 formats scaled by 1/Pi, the same format accepted
+// by sin and cos. Magnitudes of integer vectors are saturated.
+template <PolarOp Op, typename T, unsigned N>
+struct polar_vector
+{
+    static constexpr unsigned native_elems = polar_float::native_elems;
+    static constexpr unsigned num_op       = N < native_elems? 1 : N / native_elems;
+
+    using part_type       = utils::get_complex_component_type_t<T>;
+    using vector_type     = vector<T, N>;
+    using vector_ret_type = vector<part_type, N>;
+
+    __aie_inline
+    static vector_ret_type run(const vector_type &v)
+    {
+        const vector<part_type, 2 * N> parts = v.template cast_to<part_type>();
+
+        vector_ret_type ret;
+
+        utils::unroll_times<num_op>([&](auto idx) __aie_inline {
+            const vector<part_type, 2 * native_elems> block = parts.template grow_extract<2 * native_elems>(idx);
+
+            const auto [re, im] = interleave_unzip<part_type, native_elems>::run(block.template extract<native_elems>(0),
+                                                                                  block.template extract<native_elems>(1), 1);
+
+            vector<float, native_elems> tmp;
+
+            if constexpr (Op == PolarOp::Arg)
+                tmp = polar_float::atan2(to_float(im), to_float(re));
+            else
+                tmp = polar_float::hypot(to_float(im), to_float(re));
+
+            const vector<part_type, native_elems> out = from_float(tmp);
+
+            if constexpr (N < native_elems)
+                ret = out.template extract<N>(0);
+            else
+                ret.insert(idx, out);
+        });
+
+        return ret;
+    }
+
+private:
+    __aie_inline
+    static vector<float, native_elems> to_float(const vector<part_type, native_elems> &v)
+    {
+        if constexpr (std::is_same_v<part_type, float>)
+            return v;
+        else
+            return elementary_vector<ElementaryOp::Fix2Float, float, part_type, native_elems>::run(v, 0);
+    }
+
+    __aie_inline
+    static vector<part_type, native_elems> from_float(const vector<float, native_elems> &v)
+    {
+        if constexpr (std::is_same_v<part_type, float>) {
+            return v;
+        }
+        else if constexpr (Op == PolarOp::Arg) {
+            const vector<float, native_elems> w = mul<MulMacroOp::Mul, 32, float, float>::run(v, true,
+                                                                                              broadcast<float, native_elems>::run(0.318309886f), true).template to_vector<float>();
+
+            return elementary_vector<ElementaryOp::Float2Fix, part_type, float, native_elems>::run(w, type_bits_v<part_type> - 1);
+        }
+        else {
+            return elementary_vector<ElementaryOp::Float2Fix, part_type, float, native_elems>::run(v, 0);
+        }
+    }
+};
+
+} // namespace aie::detail
+
+#endif
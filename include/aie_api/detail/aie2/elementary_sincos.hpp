@@ -0,0 +1,261 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2025 Advanced Micro Devices, Inc.
+
+#pragma once
+
+#ifndef __AIE_API_DETAIL_AIE2_ELEMENTARY_SINCOS__HPP__
+#define __AIE_API_DETAIL_AIE2_ELEMENTARY_SINCOS__HPP__
+
+#include "../bit.hpp"
+#include "../blend.hpp"
+#include "../broadcast.hpp"
+#include "../compare.hpp"
+#include "../interleave.hpp"
+#include "../mul.hpp"
+#include "../neg.hpp"
+#include "../shift.hpp"
+#include "../vector.hpp"
+
+namespace aie::detail {
+
+// Sine and cosine of a 32b phase in which 2^32 corresponds to a full turn (Q1.31 scaled by 1/Pi). The two most
+// significant bits of the phase select the quadrant and the remaining 30 bits are mapped to x in [0, 1). Within the
+// quadrant, sin(Pi/2 * x) and cos(Pi/2 * x) are evaluated with degree 9 and degree 8 minimax polynomials in x whose
+// approximation error is below 7e-8. Results are then swapped and negated according to the quadrant.
+struct sincos_poly
+{
+    static constexpr unsigned native_elems = 16;
+
+    using phase_type  = vector<int32, native_elems>;
+    using result_type = vector<float, native_elems>;
+
+    __aie_inline
+    static std::pair<result_type, result_type> run(const phase_type &phase)
+    {
+        const phase_type  frac = bit<int32, native_elems, BitOp::And>::run(phase, 0x3fffffff);
+        const result_type    x = elementary_vector<ElementaryOp::Fix2Float, float, int32, native_elems>::run(frac, 30);
+        const result_type    u = mul<MulMacroOp::Mul, 32, float, float>::run(x, true, x, true).template to_vector<float>();
+
+        result_type s = mul_add(u, broadcast<float, native_elems>::run(0.000150955981f), -0.0046725478f);
+        s = mul_add(s, u,  0.0796887353f);
+        s = mul_add(s, u, -0.64596343f);
+        s = mul_add(s, u,  1.57079625f);
+        s = mul<MulMacroOp::Mul, 32, float, float>::run(s, true, x, true).template to_vector<float>();
+
+        result_type c = mul_add(u, broadcast<float, native_elems>::run(0.000859466265f), -0.0208133627f);
+        c = mul_add(c, u,  0.253652662f);
+        c = mul_add(c, u, -1.23369873f);
+        c = mul_add(c, u,  1.0f);
+
+        // Quadrant bits are tested through the sign of the phase and of the phase shifted left by one. Odd quadrants
+        // swap sine and cosine, sine is negated in quadrants 2 and 3, and cosine is negated in quadrants 1 and 2.
+        const phase_type phase_x2 = shift<int32, native_elems>::run(phase, 1, 0);
+
+        const mask<native_elems> swap    = lt<int32, native_elems>::run(phase_x2, 0);
+        const mask<native_elems> neg_sin = lt<int32, native_elems>::run(phase, 0);
+        const mask<native_elems> neg_cos = lt<int32, native_elems>::run(bit<int32, native_elems, BitOp::Xor>::run(phase, phase_x2), 0);
+
+        const result_type s_q = select<float, native_elems>::run(s, c, swap);
+        const result_type c_q = select<float, native_elems>::run(c, s, swap);
+
+        return { select<float, native_elems>::run(s_q, neg<float, native_elems>::run(s_q), neg_sin),
+                 select<float, native_elems>::run(c_q, neg<float, native_elems>::run(c_q), neg_cos) };
+    }
+
+private:
+    // Computes a * b + c
+    __aie_inline
+    static result_type mul_add(const result_type &a, const result_type &b, float c)
+    {
+        const accum<accfloat, native_elems> acc(broadcast<float, native_elems>::run(c));
+
+        return mul<MulMacroOp::Add_Mul, 32, float, float>::run(a, true, b, true, acc).template to_vector<float>();
+    }
+};
+
+template <typename T, unsigned N>
+struct sincos_vector
+{
+    static constexpr unsigned native_elems = sincos_poly::native_elems;
+    static constexpr unsigned num_op       = N < native_elems? 1 : N / native_elems;
+    static constexpr unsigned op_elems     = std::min(N, native_elems);
+
+    using  vector_type = vector<T, N>;
+    using   value_type = std::conditional_t<is_floating_point_v<T>, float, T>;
+    using op_ret_type  = vector<value_type, op_elems>;
+
+    // Invokes fn(idx, sin, cos) for each block of op_elems elements of the input
+    template <typename Fn>
+    __aie_inline
+    static void run(const vector_type &v, Fn &&fn)
+    {
+        utils::unroll_times<num_op>([&](auto idx) __aie_inline {
+            const auto [s, c] = sincos_poly::run(to_phase(v.template grow_extract<op_elems>(idx)));
+
+            fn(idx, from_float(s), from_float(c));
+        });
+    }
+
+    template <typename U>
+    __aie_inline
+    static void store(vector<U, N> &dst, unsigned idx, const vector<U, op_elems> &src)
+    {
+        if constexpr (num_op == 1)
+            dst = src;
+        else
+            dst.insert(idx, src);
+    }
+
+private:
+    template <typename U>
+    __aie_inline
+    static vector<U, native_elems> to_native(const vector<U, op_elems> &v)
+    {
+        if constexpr (op_elems < native_elems)
+            return v.template grow<native_elems>();
+        else
+            return v;
+    }
+
+    template <typename U>
+    __aie_inline
+    static vector<U, op_elems> from_native(const vector<U, native_elems> &v)
+    {
+        if constexpr (op_elems < native_elems)
+            return v.template extract<op_elems>(0);
+        else
+            return v;
+    }
+
+    // Float inputs are radians in [-Pi, Pi], int32 inputs are Q1.31 scaled by 1/Pi and int16 inputs are Q1.15 scaled
+    // by 1/Pi. All of them are converted to the 32b phase consumed by sincos_poly.
+    __aie_inline
+    static vector<int32, native_elems> to_phase(const vector<T, op_elems> &v)
+    {
+        if constexpr (is_floating_point_v<T>) {
+            const vector<float, native_elems> w = mul<MulMacroOp::Mul, 32, float, float>::run(to_native(v), true,
+                                                                                              broadcast<float, native_elems>::run(0.318309886f), true).template to_vector<float>();
+
+            return elementary_vector<ElementaryOp::Float2Fix, int32, float, native_elems>::run(w, 31);
+        }
+        else if constexpr (std::is_same_v<T, int16>) {
+            return shift<int32, native_elems>::run(to_native(v).template unpack<int32>(), 16, 0);
+        }
+        else {
+            return to_native(v);
+        }
+    }
+
+    // Integer results are returned in Q.15 format. Values are scaled by 32767 so that +1.0 does not overflow.
+    __aie_inline
+    static op_ret_type from_float(const vector<float, native_elems> &v)
+    {
+        if constexpr (is_floating_point_v<T>) {
+            return from_native(v);
+        }
+        else {
+            const vector<float, native_elems> w = mul<MulMacroOp::Mul, 32, float, float>::run(v, true,
+                                                                                              broadcast<float, native_elems>::run(32767.0f), true).template to_vector<float>();
+
+            return from_native(elementary_vector<ElementaryOp::Float2Fix, T, float, native_elems>::run(w, 0));
+        }
+    }
+};
+
+template <unsigned TypeBits, typename T, unsigned N> requires(utils::is_one_of_v<T, int16, int32, float>)
+struct elementary_vector_bits_impl<ElementaryOp::Sin, TypeBits, T, T, N>
+{
+    using vector_type = vector<T, N>;
+
+    __aie_inline
+    static vector_type run(const vector_type &v, int shift = 0, bool sign_dummy = false)
+    {
+        vector_type ret;
+
+        sincos_vector<T, N>::run(v, [&](unsigned idx, const auto &s, const auto &c) __aie_inline {
+            sincos_vector<T, N>::store(ret, idx, s);
+        });
+
+        return ret;
+    }
+};
+
+template <unsigned TypeBits, typename T, unsigned N> requires(utils::is_one_of_v<T, int16, int32, float>)
+struct elementary_vector_bits_impl<ElementaryOp::Cos, TypeBits, T, T, N>
+{
+    using vector_type = vector<T, N>;
+
+    __aie_inline
+    static vector_type run(const vector_type &v, int shift = 0, bool sign_dummy = false)
+    {
+        vector_type ret;
+
+        sincos_vector<T, N>::run(v, [&](unsigned idx, const auto &s, const auto &c) __aie_inline {
+            sincos_vector<T, N>::store(ret, idx, c);
+        });
+
+        return ret;
+    }
+};
+
+template <unsigned TypeBits, typename T, unsigned N> requires(utils::is_one_of_v<T, int16, int32, float>)
+struct elementary_vector_bits_impl<ElementaryOp::SinCos, TypeBits, T, T, N>
+{
+    using vector_type = vector<T, N>;
+
+    __aie_inline
+    static std::pair<vector_type, vector_type> run(const vector_type &v, int shift = 0, bool sign_dummy = false)
+    {
+        vector_type ret_sin, ret_cos;
+
+        sincos_vector<T, N>::run(v, [&](unsigned idx, const auto &s, const auto &c) __aie_inline {
+            sincos_vector<T, N>::store(ret_sin, idx, s);
+            sincos_vector<T, N>::store(ret_cos, idx, c);
+        });
+
+        return { ret_sin, ret_cos };
+    }
+};
+
+template <unsigned TypeBits, typename TR, typename T, unsigned N>
+    requires((std::is_same_v<TR, cint16> && utils::is_one_of_v<T, int16, int32>) ||
+             (std::is_same_v<TR, cfloat> && std::is_same_v<T, float>))
+struct elementary_vector_bits_impl<ElementaryOp::SinCosComplex, TypeBits, TR, T, N>
+{
+    using     vector_type = vector<T, N>;
+    using vector_ret_type = vector<TR, N>;
+
+    using part_type = std::conditional_t<std::is_same_v<TR, cint16>, int16, float>;
+
+    __aie_inline
+    static vector_ret_type run(const vector_type &v, int shift = 0, bool sign_dummy = false)
+    {
+        vector<part_type, N> re, im;
+
+        sincos_vector<T, N>::run(v, [&](unsigned idx, const auto &s, const auto &c) __aie_inline {
+            // int32 results are in Q.15 range, so they are narrowed to int16 before building the complex output
+            if constexpr (std::is_same_v<part_type, T>) {
+                sincos_vector<T, N>::store(im, idx, s);
+                sincos_vector<T, N>::store(re, idx, c);
+            }
+            else {
+                sincos_vector<T, N>::store(im, idx, s.template pack<part_type>());
+                sincos_vector<T, N>::store(re, idx, c.template pack<part_type>());
+            }
+        });
+
+        // Cosine goes to the real part and sine to the imaginary part
+        const auto [lo, hi] = interleave_zip<part_type, N>::run(re, im, 1);
+
+        vector_ret_type ret;
+        ret.insert(0, lo.template cast_to<TR>());
+        ret.insert(1, hi.template cast_to<TR>());
+
+        return ret;
+    }
+};
+
+} // namespace aie::detail
+
+#endif
@@ -7,6 +7,8 @@
 #ifndef __AIE_API_DETAIL_AIE2_LOCK__HPP__
 #define __AIE_API_DETAIL_AIE2_LOCK__HPP__
 
+#include <array>
+
 namespace aie::detail {
 
 class mutex {
@@ -38,8 +40,47 @@ public:
     }
 };
 
+// Buffers shared by several readers or writers use a pair of locks between each writer and each reader. A single pair
+// of counted locks would let a fast party take the count released for a slower one. Each writer owns the pairs that
+// connect it to every reader and each reader owns the pairs that connect it to every writer. Every lock still counts
+// buffers with acquire_greater_equal: the write lock of a pair is initialized to the number of buffers and the read lock
+// to zero. A set of buffers with R readers and W writers therefore uses 2 * R * W hardware locks, whatever the number of
+// buffers.
 template <unsigned Readers, unsigned Writers>
-class producer_sem;
+class producer_sem
+{
+private:
+    const std::array<unsigned, Readers> lock_read_ids_;
+    const std::array<unsigned, Readers> lock_write_ids_;
+
+    producer_sem()                                = delete;
+    producer_sem(const producer_sem &)            = delete;
+    producer_sem(producer_sem &&)                 = delete;
+
+    producer_sem &operator=(const producer_sem &) = delete;
+    producer_sem &operator=(producer_sem &&)      = delete;
+
+public:
+    // Waits until every reader has released the buffer
+    void lock()
+    {
+        for (unsigned r = 0; r < Readers; ++r)
+            ::acquire_greater_equal(lock_write_ids_[r], 1);
+    }
+
+    void unlock()
+    {
+        for (unsigned r = 0; r < Readers; ++r)
+            ::release(lock_read_ids_[r], 1);
+    }
+
+    // Lock ids of the pairs that connect this writer to each reader
+    producer_sem(const std::array<unsigned, Readers> &lock_read_ids, const std::array<unsigned, Readers> &lock_write_ids) :
+        lock_read_ids_(lock_read_ids),
+        lock_write_ids_(lock_write_ids)
+    {
+    }
+};
 
 template <>
 class producer_sem<1, 1>
@@ -74,7 +115,40 @@ public:
 };
 
 template <unsigned Readers, unsigned Writers>
-class consumer_sem;
+class consumer_sem
+{
+private:
+    const std::array<unsigned, Writers> lock_read_ids_;
+    const std::array<unsigned, Writers> lock_write_ids_;
+
+    consumer_sem()                                = delete;
+    consumer_sem(const consumer_sem &)            = delete;
+    consumer_sem(consumer_sem &&)                 = delete;
+
+    consumer_sem &operator=(const consumer_sem &) = delete;
+    consumer_sem &operator=(consumer_sem &&)      = delete;
+
+public:
+    // Waits until every writer has released the buffer
+    void lock()
+    {
+        for (unsigned w = 0; w < Writers; ++w)
+            ::acquire_greater_equal(lock_read_ids_[w], 1);
+    }
+
+    void unlock()
+    {
+        for (unsigned w = 0; w < Writers; ++w)
+            ::release(lock_write_ids_[w], 1);
+    }
+
+    // Lock ids of the pairs that connect this reader to each writer
+    consumer_sem(const std::array<unsigned, Writers> &lock_read_ids, const std::array<unsigned, Writers> &lock_write_ids) :
+        lock_read_ids_(lock_read_ids),
+        lock_write_ids_(lock_write_ids)
+    {
+    }
+};
 
 template <>
 class consumer_sem<1, 1> {
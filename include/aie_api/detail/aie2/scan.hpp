@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2025 Advanced Micro Devices, Inc.
+
+#pragma once
+
+#ifndef __AIE_API_DETAIL_AIE2_SCAN__HPP__
+#define __AIE_API_DETAIL_AIE2_SCAN__HPP__
+
+#include "../vector_accum_cast.hpp"
+
+namespace aie::detail {
+
+template <AccumElemBaseType AccumTag, unsigned Elems>
+struct scan_accum_bits_impl
+{
+    using accum_type = accum<AccumTag, Elems>;
+
+    // Accumulator lanes are moved by reinterpreting the accumulator as a vector of 32b words. Wider lanes span several
+    // words, so shifts are scaled accordingly.
+    static constexpr unsigned words_per_lane = accum_type::value_bits() / 32;
+    static constexpr unsigned vector_elems   = Elems * words_per_lane;
+
+    using acc_to_vec = accum_to_vector_cast<int32, AccumTag, Elems>;
+    using vec_to_acc = vector_to_accum_cast<AccumTag, int32, vector_elems>;
+
+    __aie_inline
+    static accum_type run_inclusive(const accum_type &acc)
+    {
+        const vector<int32, vector_elems> zero = zeros<int32, vector_elems>::run();
+        accum_type ret = acc;
+
+        utils::unroll_times<utils::log2(Elems)>([&](unsigned idx) __aie_inline {
+            const accum_type tmp = vec_to_acc::run(shuffle_up_fill<int32, vector_elems>::run(acc_to_vec::run(ret), zero,
+                                                                                             (1u << idx) * words_per_lane));
+
+            ret = add_accum<AccumTag, Elems>::run(ret, false, tmp);
+        });
+
+        return ret;
+    }
+
+    __aie_inline
+    static accum_type run_exclusive(const accum_type &acc)
+    {
+        const vector<int32, vector_elems> zero = zeros<int32, vector_elems>::run();
+
+        return run_inclusive(vec_to_acc::run(shuffle_up_fill<int32, vector_elems>::run(acc_to_vec::run(acc), zero, words_per_lane)));
+    }
+};
+
+}
+
+#endif
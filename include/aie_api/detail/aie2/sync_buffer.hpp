@@ -24,6 +24,14 @@ public:
         return (unsigned)idx_;
     }
 
+    constexpr unsigned get_next_index() const
+    {
+        if constexpr (NumBuffers == 2)
+            return 1 - (unsigned)idx_;
+        else
+            return (unsigned)idx_ == NumBuffers - 1? 0 : (unsigned)idx_ + 1;
+    }
+
     constexpr unsigned operator++()
     {
         if constexpr (NumBuffers == 2)
@@ -85,11 +93,29 @@ public:
 
     Span &acquire()
     {
-        this->locks_.lock();
+        if (!next_acquired_)
+            this->locks_.lock();
+
+        next_acquired_ = false;
 
         return this->buffers_[index_.get_index()];
     }
 
+    // Acquires the buffer that follows the current one while the latter is still held, so that its first elements can
+    // be loaded before the current buffer is released. The next call to acquire returns it without waiting again. The
+    // current buffer must be held, and acquire_next cannot be called again until it has been released: otherwise the
+    // returned buffer would be guarded by the lock count of another buffer.
+    Span &acquire_next() requires (NumBuffers > 1)
+    {
+        RUNTIME_ASSERT(!next_acquired_, "The next buffer has already been acquired");
+
+        this->locks_.lock();
+
+        next_acquired_ = true;
+
+        return this->buffers_[index_.get_next_index()];
+    }
+
     void release()
     {
         this->locks_.unlock();
@@ -116,6 +142,7 @@ private:
     Span buffers_[NumBuffers];
     mutex_type &locks_;
     [[no_unique_address]] sync_data_index<NumBuffers> index_;
+    bool next_acquired_ = false;
 };
 
 template <direction Direction, typename T, unsigned NumBuffers, unsigned NumReaders, unsigned NumWriters, size_t... Is>
@@ -150,11 +177,25 @@ public:
 
     value_type *acquire()
     {
-        this->locks_.lock();
+        if (!next_acquired_)
+            this->locks_.lock();
+
+        next_acquired_ = false;
 
         return this->buffers_[index_.get_index()];
     }
 
+    value_type *acquire_next() requires (NumBuffers > 1)
+    {
+        RUNTIME_ASSERT(!next_acquired_, "The next buffer has already been acquired");
+
+        this->locks_.lock();
+
+        next_acquired_ = true;
+
+        return this->buffers_[index_.get_next_index()];
+    }
+
     void release()
     {
         this->locks_.unlock();
@@ -182,6 +223,7 @@ private:
     mutex_type &locks_;
     size_t size_;
     [[no_unique_address]] sync_data_index<NumBuffers> index_;
+    bool next_acquired_ = false;
 };
 
 template <direction Direction, typename T, size_t Elems, unsigned NumBuffers, unsigned NumReaders, unsigned NumWriters, size_t... Is>
@@ -214,11 +256,25 @@ public:
 
     value_type *acquire()
     {
-        this->locks_.lock();
+        if (!next_acquired_)
+            this->locks_.lock();
+
+        next_acquired_ = false;
 
         return this->buffers_[index_.get_index()];
     }
 
+    value_type *acquire_next() requires (NumBuffers > 1)
+    {
+        RUNTIME_ASSERT(!next_acquired_, "The next buffer has already been acquired");
+
+        this->locks_.lock();
+
+        next_acquired_ = true;
+
+        return this->buffers_[index_.get_next_index()];
+    }
+
     void release()
     {
         this->locks_.unlock();
@@ -245,6 +301,7 @@ private:
     T *buffers_[NumBuffers];
     mutex_type &locks_;
     [[no_unique_address]] sync_data_index<NumBuffers> index_;
+    bool next_acquired_ = false;
 };
 
 }
@@ -546,5 +546,8 @@ struct elementary_bits_impl<ElementaryOp::Sqrt, TypeBits, float, bfloat16>    :
 
 }
 
+#include "../aie2/elementary_sincos.hpp"
+#include "../aie2/elementary_atan2.hpp"
+
 #endif
 
@@ -0,0 +1,30 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2025 Advanced Micro Devices, Inc.
+
+#pragma once
+
+#ifndef __AIE_API_DETAIL_AIE2P_SOFTMAX__HPP__
+#define __AIE_API_DETAIL_AIE2P_SOFTMAX__HPP__
+
+namespace aie::detail {
+
+// XDNA 2 provides a native exp2, so no approximation state is kept
+template <>
+class softmax_exp<16>
+{
+public:
+    static constexpr unsigned lanes = 16;
+
+    __aie_inline
+    vector<float, lanes> run(const vector<float, lanes> &x)
+    {
+        const vector<bfloat16, lanes> e = aie::exp2(aie::mul(x, 1.44269504f).template to_vector<float>());
+
+        return aie::mul(e, bfloat16(1.0f)).template to_vector<float>();
+    }
+};
+
+}
+
+#endif
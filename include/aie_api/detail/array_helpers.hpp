@@ -48,10 +48,7 @@ template <typename T, unsigned Elems, typename IterDescriptor, aie_dm_resource R
     requires (arch::is(arch::Gen2))
 using          const_sliding_window_buffer_stream = sliding_window_buffer_stream<const std::remove_const_t<T>, Elems, IterDescriptor, Resource>;
 
-template <typename T, unsigned Elems, unsigned Level, typename TensorIterDescriptor, aie_dm_resource Resource, bool Restrict = false>
-#if __AIE_API_SUPPORTED_FRIEND_CONCEPTS__
-    requires (arch::is(arch::Gen2))
-#endif
+template <typename T, unsigned Elems, unsigned Level, typename TensorIterDescriptor, aie_dm_resource Resource, bool Restrict = false, bool Circular = false>
 class __AIE_API_KEEP_IN_REGISTERS__ tensor_buffer_stream;
 
 struct dim_2d
@@ -197,12 +194,93 @@ template <typename T, unsigned Elems> struct tensor_vector_type { using type = v
 template <typename T, unsigned Elems> using tensor_vector_type_t = typename tensor_vector_type<T, Elems>::type;
 #endif
 
+// Pointer arithmetic used by tensor buffer streams. AIE-ML and XDNA 2 provide 2D and 3D address generation, which is
+// emulated on AIE with scalar counters. Counters follow the same convention: each one is reset after reaching its
+// limit, and the increment of the next dimension is applied instead.
+template <typename Pointer>
+__aie_inline
+constexpr Pointer tensor_byte_incr(Pointer ptr, int inc)
+{
 #if AIE_API_ML_VERSION >= 200
+    return ::byte_incr(ptr, inc);
+#else
+    return (Pointer)((char *)ptr + inc);
+#endif
+}
 
-template <typename T, unsigned Elems, unsigned Level, typename TensorIterDescriptor, aie_dm_resource Resource, bool Restrict>
-#if __AIE_API_SUPPORTED_FRIEND_CONCEPTS__
-    requires (arch::is(arch::Gen2))
+template <typename Pointer>
+__aie_inline
+constexpr Pointer tensor_add_2d_byte(Pointer ptr, int inc2, unsigned num1, addr_t &c1, int inc1)
+{
+#if AIE_API_ML_VERSION >= 200
+    return ::add_2d_byte(ptr, inc2, num1, c1, inc1);
+#else
+    const bool wrap1 = unsigned(c1) >= num1;
+
+    c1 = wrap1? 0 : c1 + 1;
+
+    return tensor_byte_incr(ptr, wrap1? inc2 : inc1);
 #endif
+}
+
+template <typename Pointer>
+__aie_inline
+constexpr Pointer tensor_add_3d_byte(Pointer ptr, int inc3, unsigned num1, addr_t &c1, int inc1, unsigned num2, addr_t &c2, int inc2)
+{
+#if AIE_API_ML_VERSION >= 200
+    return ::add_3d_byte(ptr, inc3, num1, c1, inc1, num2, c2, inc2);
+#else
+    const bool wrap1 = unsigned(c1) >= num1;
+    const bool wrap2 = wrap1 && unsigned(c2) >= num2;
+
+    c1 = wrap1? 0 : c1 + 1;
+    c2 = wrap2? 0 : (wrap1? c2 + 1 : c2);
+
+    return tensor_byte_incr(ptr, wrap2? inc3 : (wrap1? inc2 : inc1));
+#endif
+}
+
+// Memory range into which the addresses of circular tensor buffer streams are wrapped. Each address increment must be
+// smaller than the size of the range.
+template <bool Circular>
+struct tensor_circular_range
+{
+    template <typename Pointer>
+    __aie_inline
+    constexpr Pointer wrap(Pointer ptr) const { return ptr; }
+};
+
+template <>
+struct tensor_circular_range<true>
+{
+    const void *base;
+    int size;
+
+    template <typename Pointer>
+    __aie_inline
+    constexpr Pointer wrap(Pointer ptr) const
+    {
+        const int offset = int((const char *)ptr - (const char *)base);
+
+        return tensor_byte_incr(ptr, offset >= size? -size : (offset < 0? size : 0));
+    }
+};
+
+// Stream returned by the level that precedes the innermost one. Sliding window streams are only named when selected, as
+// they are not available on AIE.
+template <bool NextSliding, typename T, unsigned Elems, typename IterDescriptor, aie_dm_resource Resource, typename NestedStream>
+struct tensor_inner_stream
+{
+    using type = NestedStream;
+};
+
+template <typename T, unsigned Elems, typename IterDescriptor, aie_dm_resource Resource, typename NestedStream>
+struct tensor_inner_stream<true, T, Elems, IterDescriptor, Resource, NestedStream>
+{
+    using type = sliding_window_buffer_stream<T, Elems, IterDescriptor, Resource>;
+};
+
+template <typename T, unsigned Elems, unsigned Level, typename TensorIterDescriptor, aie_dm_resource Resource, bool Restrict, bool Circular>
 class __AIE_API_KEEP_IN_REGISTERS__ tensor_buffer_stream
 {
 public:
@@ -221,12 +299,14 @@ public:
                                                                                          sliding_window_dim_3d>;
     using inner_type = std::conditional_t<Level == MaxDepth,
                                           vector_type,
-                                          std::conditional_t<next_sliding,
-                                                             sliding_window_buffer_stream<T, Elems, std::tuple_element_t<MaxDepth, iter_desc_t>, Resource>,
-                                                             tensor_buffer_stream<T, Elems, Level + 1, iter_desc_storage, Resource, Restrict>>>;
+                                          typename tensor_inner_stream<next_sliding, T, Elems, std::tuple_element_t<MaxDepth, iter_desc_t>, Resource,
+                                                                       tensor_buffer_stream<T, Elems, Level + 1, iter_desc_storage, Resource, Restrict, Circular>>::type>;
+
+    static_assert(!(Circular && next_sliding), "Sliding window dimensions are not supported in circular tensor buffer streams");
 
     __aie_inline
-    constexpr tensor_buffer_stream(T *ptr, const TensorIterDescriptor& iter_desc) : ptr_(ptr), iter_desc_(iter_desc) {}
+    constexpr tensor_buffer_stream(T *ptr, const TensorIterDescriptor& iter_desc, tensor_circular_range<Circular> range = {}) :
+        ptr_(ptr), iter_desc_(iter_desc), range_(range) {}
 
     tensor_buffer_stream(const tensor_buffer_stream&)            = default;
     tensor_buffer_stream& operator=(const tensor_buffer_stream&) = default;
@@ -248,7 +328,7 @@ public:
             return v;
         }
         else {
-            inner_type v = inner_type(ptr_, iter_desc_);
+            inner_type v = inner_type(ptr_, iter_desc_, range_);
             increment();
             return v;
         }
@@ -290,23 +370,23 @@ private:
     {
         const auto& inc = std::get<Level>(iter_desc_);
         if      constexpr (std::is_same_v<dim_3d, std::decay_t<decltype(inc)>>) {
-            ptr_ = ::add_3d_byte(ptr_, inc.inc3,
-                                       inc.num1, iter_state_.state_.c1, inc.inc1,
-                                       inc.num2, iter_state_.state_.c2, inc.inc2);
+            ptr_ = tensor_add_3d_byte(ptr_, inc.inc3,
+                                            inc.num1, iter_state_.state_.c1, inc.inc1,
+                                            inc.num2, iter_state_.state_.c2, inc.inc2);
         }
         else if constexpr (std::is_same_v<dim_2d, std::decay_t<decltype(inc)>>) {
-            ptr_ = ::add_2d_byte(ptr_, inc.inc2,
-                                       inc.num1, iter_state_.state_.c1, inc.inc1);
+            ptr_ = tensor_add_2d_byte(ptr_, inc.inc2,
+                                            inc.num1, iter_state_.state_.c1, inc.inc1);
         }
         else {
-            ptr_ = ::byte_incr(ptr_, inc);
+            ptr_ = tensor_byte_incr(ptr_, inc);
         }
+
+        if constexpr (Circular)
+            ptr_ = range_.wrap(ptr_);
     }
 
-    template <typename T2, unsigned Elems2, unsigned Level2, typename TensorIterDescriptor2, aie_dm_resource Resource2, bool Restrict2>
-#if __AIE_API_SUPPORTED_FRIEND_CONCEPTS__
-        requires (arch::is(arch::Gen2))
-#endif
+    template <typename T2, unsigned Elems2, unsigned Level2, typename TensorIterDescriptor2, aie_dm_resource Resource2, bool Restrict2, bool Circular2>
     friend class tensor_buffer_stream;
 
 #if AIE_API_NATIVE
@@ -319,6 +399,7 @@ private:
     ptr_type ptr_;
     iter_desc_storage iter_desc_;
     iter_state_storage iter_state_;
+    [[no_unique_address]] tensor_circular_range<Circular> range_;
 };
 
 #if __AIE_ARCH__ == 21
@@ -476,8 +557,6 @@ class tensor_buffer_stream<bfp16ebs16, Elems, Level, TensorIterDescriptor, Resou
 };
 #endif
 
-#endif
-
 template <size_t Stride>
 struct iterator_stride
 {
@@ -500,6 +579,9 @@ enum class FifoDirection {
 template <typename Pointer, size_t Elems, size_t Stride>
 struct random_circular_iterator_storage;
 
+template <typename T, unsigned Elems, aie_dm_resource Resource>
+class unaligned_vector_iterator;
+
 } // namespace aie::detail
 
 #if __AIE_ARCH__ == 10
@@ -1163,7 +1245,8 @@ private:
     circular_iterator<ptrdiff_t, Steps, 1, aie_dm_resource::none> idx_;
 };
 
-// TODO: Add optimized implementations for AIE1/AIE2
+// Default implementation, which reads and writes through unaligned references. The architecture backends can provide
+// optimized specializations for read-only iterators.
 template <typename T, unsigned Elems, aie_dm_resource Resource>
 class unaligned_vector_iterator
 {
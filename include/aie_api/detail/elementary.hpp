@@ -28,6 +28,11 @@ enum class ElementaryOp {
     Exp2
 };
 
+// Input types for which AIE-ML and XDNA 2 provide a vectorized implementation of sin/cos
+template <typename T>
+static constexpr bool is_vector_sincos_supported_v = (__AIE_ARCH__ == 20 || __AIE_ARCH__ == 21) &&
+                                                     utils::is_one_of_v<T, int16, int32, float>;
+
 template <ElementaryOp Op, unsigned TypeBits, typename TR, typename T>
 struct elementary_bits_impl
 {
@@ -0,0 +1,86 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2025 Advanced Micro Devices, Inc.
+
+#pragma once
+
+#ifndef __AIE_API_DETAIL_GATHER__HPP__
+#define __AIE_API_DETAIL_GATHER__HPP__
+
+#include "add.hpp"
+#include "compare.hpp"
+#include "ld_st.hpp"
+#include "shuffle.hpp"
+#include "vector.hpp"
+#include "../mask.hpp"
+
+namespace aie::detail {
+
+// Indexed loads and stores. Index vectors whose elements are consecutive are served with a single unaligned vector
+// access. Otherwise, indices are spilled to the stack and elements are moved with scalar accesses, which can be
+// software pipelined, through a vector-aligned staging buffer.
+template <typename T, typename IndexT, unsigned Elems, aie_dm_resource Resource>
+struct gather_scatter
+{
+    using         elem_type = std::remove_const_t<aie_dm_resource_remove_t<T>>;
+    using       vector_type = vector<elem_type, Elems>;
+    using index_vector_type = vector<IndexT, Elems>;
+
+    __aie_inline
+    static bool is_consecutive(const index_vector_type &idx)
+    {
+        // The last lane of the shuffled vector is undefined, so it is always accepted
+        const index_vector_type diff = sub<IndexT, Elems>::run(shuffle_down<IndexT, Elems>::run(idx, 1), idx);
+
+        mask<Elems> m = eq<IndexT, Elems>::run(diff, IndexT(1));
+        m.set(Elems - 1);
+
+        return m == mask<Elems>(true);
+    }
+
+    __aie_inline
+    static vector_type gather(const T *ptr, const index_vector_type &idx)
+    {
+        if (is_consecutive(idx))
+            return load_unaligned_vector<Elems, Resource>(ptr + idx.get(0));
+
+        alignas(vector_decl_align) IndexT    idx_buf[Elems];
+        alignas(vector_decl_align) elem_type buf[Elems];
+
+        store_vector<Elems>(idx_buf, idx);
+
+        for (unsigned i = 0; i < Elems; ++i)
+            chess_prepare_for_pipelining
+        {
+            buf[i] = ptr[idx_buf[i]];
+        }
+
+        return load_vector<Elems>(buf);
+    }
+
+    // Elements are written in lane order, so the last lane wins when indices are repeated
+    __aie_inline
+    static void scatter(T *ptr, const index_vector_type &idx, const vector_type &v)
+    {
+        if (is_consecutive(idx)) {
+            store_unaligned_vector<Elems, Resource>(ptr + idx.get(0), v);
+            return;
+        }
+
+        alignas(vector_decl_align) IndexT    idx_buf[Elems];
+        alignas(vector_decl_align) elem_type buf[Elems];
+
+        store_vector<Elems>(idx_buf, idx);
+        store_vector<Elems>(buf, v);
+
+        for (unsigned i = 0; i < Elems; ++i)
+            chess_prepare_for_pipelining
+        {
+            ptr[idx_buf[i]] = buf[i];
+        }
+    }
+};
+
+} // namespace aie::detail
+
+#endif
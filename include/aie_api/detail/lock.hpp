@@ -16,6 +16,7 @@
 namespace aie::detail {
 
 struct adopt_lock_t {};
+struct defer_lock_t {};
 
 // Forward declaration for classes implemented in the architecture backends
 class          mutex;
@@ -43,57 +44,82 @@ class scoped_lock_impl {
     using  mutex_type = MutexType;
 
     mutex_type *m_;
+    bool owns_;
 
 private:
     // Not copy-constructible and not copy-assignable
     scoped_lock_impl(const scoped_lock_impl &)            = delete;
     scoped_lock_impl &operator=(const scoped_lock_impl &) = delete;
 
-    void lock()
-    {
-        m_->lock();
-    }
-
-    void unlock()
-    {
-        if (m_)
-            m_->unlock();
-    }
-
 public:
     explicit scoped_lock_impl(mutex_type &m) :
-        m_(&m)
+        m_(&m),
+        owns_(false)
     {
         lock();
     }
 
     explicit scoped_lock_impl(adopt_lock_t, mutex_type &m) :
-        m_(&m)
+        m_(&m),
+        owns_(true)
     {
     }
 
-    ~scoped_lock_impl()
+    // The lock is taken later with lock(), so that independent work can be scheduled before the point at which the
+    // kernel may have to wait
+    explicit scoped_lock_impl(defer_lock_t, mutex_type &m) :
+        m_(&m),
+        owns_(false)
     {
-        unlock();
     }
 
-    scoped_lock_impl(scoped_lock_impl && l)
+    ~scoped_lock_impl()
     {
-        unlock();
+        if (owns_)
+            unlock();
+    }
 
-        m_    = l->m_;
-        l->m_ = nullptr;
+    scoped_lock_impl(scoped_lock_impl && l) :
+        m_(l.m_),
+        owns_(l.owns_)
+    {
+        l.m_    = nullptr;
+        l.owns_ = false;
     }
 
     scoped_lock_impl &operator=(scoped_lock_impl && l)
     {
-        unlock(*m_);
+        if (owns_)
+            unlock();
 
-        m_    = l->m_;
-        l->m_ = nullptr;
+        m_      = l.m_;
+        owns_   = l.owns_;
+        l.m_    = nullptr;
+        l.owns_ = false;
 
         return *this;
     }
+
+    void lock()
+    {
+        RUNTIME_ASSERT(m_ != nullptr && !owns_, "The lock must have a mutex that it does not own");
+
+        m_->lock();
+        owns_ = true;
+    }
+
+    void unlock()
+    {
+        RUNTIME_ASSERT(m_ != nullptr && owns_, "The lock must own its mutex");
+
+        m_->unlock();
+        owns_ = false;
+    }
+
+    bool owns_lock() const
+    {
+        return owns_;
+    }
 };
 
 template <size_t... Indices, typename... MutexTypes>
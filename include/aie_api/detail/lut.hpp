@@ -7,6 +7,12 @@
 #ifndef __AIE_API_DETAIL_LUT_HPP__
 #define __AIE_API_DETAIL_LUT_HPP__
 
+#include <array>
+#include <limits>
+#include <type_traits>
+
+#include "ld_st.hpp"
+
 namespace aie::detail {
 
 enum class lut_oor_policy {
@@ -59,6 +65,136 @@ struct lut<1, OffsetType, SlopeType>
       const void* LUT_a_;
 };
 
+
+// Width of the memory banks at which granularity lookup tables are replicated for parallel accesses
+static constexpr unsigned lut_bank_bytes = 16;
+
+// Number of points at which each segment of a linear approximation is sampled to center its error
+static constexpr unsigned lut_fit_points = 32;
+
+template <typename T>
+constexpr T lut_convert(double v)
+{
+    if constexpr (std::is_floating_point_v<T>) {
+        return T(v);
+    }
+    else {
+        constexpr double lo = double(std::numeric_limits<T>::min());
+        constexpr double hi = double(std::numeric_limits<T>::max());
+
+        v = v < lo? lo : (v > hi? hi : v);
+
+        return T(v < 0? v - 0.5 : v + 0.5);
+    }
+}
+
+// Rounds to the nearest bfloat16 value, keeping the result in float storage with the low 16 mantissa bits set to zero
+constexpr float lut_round_bfloat16(float v)
+{
+    const uint32 bits = __builtin_bit_cast(uint32, v);
+
+    return __builtin_bit_cast(float, uint32((bits + 0x7fff + ((bits >> 16) & 1)) & 0xffff0000));
+}
+
+template <unsigned ParallelAccesses, typename Storage, unsigned Words, unsigned Elems>
+struct lut_table
+{
+    static constexpr unsigned bank_words = lut_bank_bytes / sizeof(Storage);
+    static constexpr unsigned copies     = ParallelAccesses == 1? 1 : 2;
+
+    static_assert(ParallelAccesses == 1 || Words % bank_words == 0,
+                  "Lookup tables with parallel accesses must span a whole number of memory banks");
+
+    alignas(vector_decl_align) std::array<Storage, Words * copies> values{};
+
+    static constexpr unsigned size()
+    {
+        return Elems;
+    }
+
+    constexpr const Storage *data() const
+    {
+        return values.data();
+    }
+
+    // Writes a word of the logical table into all its copies, which are interleaved at bank width granularity
+    constexpr void set(unsigned w, Storage v)
+    {
+        if constexpr (copies == 1) {
+            values[w] = v;
+        }
+        else {
+            const unsigned base = (w / bank_words) * copies * bank_words + w % bank_words;
+
+            for (unsigned c = 0; c < copies; ++c)
+                values[base + c * bank_words] = v;
+        }
+    }
+};
+
+template <unsigned ParallelAccesses, typename T, unsigned Elems, typename Fn>
+constexpr auto make_lookup_lut(Fn &&func, double first, double last)
+{
+    // 8b values are stored as 16b values due to the granularity of the memory accesses
+    using storage_type = std::conditional_t<sizeof(T) == 1, std::conditional_t<std::is_signed_v<T>, int16, uint16>, T>;
+
+    lut_table<ParallelAccesses, storage_type, Elems, Elems> ret;
+
+    const double width = (last - first) / Elems;
+
+    for (unsigned i = 0; i < Elems; ++i)
+        ret.set(i, storage_type(lut_convert<T>(func(first + i * width))));
+
+    return ret;
+}
+
+template <unsigned ParallelAccesses, typename OffsetType, typename SlopeType, unsigned Elems, typename Fn>
+constexpr auto make_linear_approx_lut(Fn &&func, double first, double last, unsigned step_bits, int shift_offset)
+{
+    lut_table<ParallelAccesses, OffsetType, 2 * Elems, Elems> ret;
+
+    const double width = (last - first) / Elems;
+
+    for (unsigned i = 0; i < Elems; ++i) {
+        const double x0    = first + i * width;
+        const double f0    = func(x0);
+        const double chord = (func(x0 + width) - f0) / width;
+
+        // Floating-point slopes are used as bfloat16, so the offset is fitted to the rounded slope
+        const double slope = std::is_floating_point_v<OffsetType>? double(lut_round_bfloat16(float(chord))) : chord;
+
+        // The chord of the segment is shifted by the midpoint of its deviations from the function, which minimizes the
+        // maximum error for functions that are convex or concave within the segment
+        double dmin = 0, dmax = 0;
+
+        for (unsigned k = 1; k < lut_fit_points; ++k) {
+            const double x = x0 + width * k / lut_fit_points;
+            const double d = func(x) - (f0 + slope * (x - x0));
+
+            dmin = d < dmin? d : dmin;
+            dmax = d > dmax? d : dmax;
+        }
+
+        const double offset = f0 + (dmin + dmax) / 2;
+
+        // Slope is stored in the LSB and offset in the MSB of each pair
+        if constexpr (std::is_floating_point_v<OffsetType>) {
+            // output = slope * input + offset
+            ret.set(2 * i,     float(slope));
+            ret.set(2 * i + 1, float(offset - slope * x0));
+        }
+        else {
+            // output = slope * remainder + (offset << shift_offset), with remainder in [0, 2^step_bits)
+            const double slope_scale = width * double(1ull << shift_offset) / double(1ull << step_bits);
+
+            ret.set(2 * i,     lut_convert<SlopeType>(slope * slope_scale));
+            ret.set(2 * i + 1, lut_convert<OffsetType>(offset));
+        }
+    }
+
+    return ret;
+}
+
 }
 
 #endif
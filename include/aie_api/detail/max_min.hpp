@@ -237,6 +237,22 @@ using max_reduce = max_min_reduce_bits<type_bits_v<T>, T, Elems, MaxMinOperation
 template <typename T, unsigned Elems>
 using min_reduce = max_min_reduce_bits<type_bits_v<T>, T, Elems, MaxMinOperation::Min>;
 
+// Returns the index of the first lane set in the mask, or Elems if no lane is set
+template <unsigned Elems>
+__aie_inline
+constexpr unsigned first_set_lane(const mask<Elems> &m)
+{
+    for (unsigned w = 0; w < (Elems + 31) / 32; ++w) {
+        const unsigned word = m.to_uint32(w);
+
+        // The lowest set bit is isolated and the bits below it are counted
+        if (word != 0)
+            return w * 32 + mask<32>::from_uint32((word & (~word + 1)) - 1).count();
+    }
+
+    return Elems;
+}
+
 }
 
 #if __AIE_ARCH__ == 10
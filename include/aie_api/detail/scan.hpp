@@ -0,0 +1,92 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2025 Advanced Micro Devices, Inc.
+
+#pragma once
+
+#ifndef __AIE_API_DETAIL_SCAN__HPP__
+#define __AIE_API_DETAIL_SCAN__HPP__
+
+#include "../accum.hpp"
+#include "../vector.hpp"
+
+#include "add.hpp"
+#include "broadcast.hpp"
+#include "shuffle.hpp"
+
+namespace aie::detail {
+
+template <unsigned TypeBits, typename T, unsigned Elems>
+struct scan_bits_impl
+{
+    using vector_type = vector<T, Elems>;
+
+    static constexpr unsigned native_elems = std::min(Elems, native_vector_length_v<T>);
+
+    // Hillis-Steele scan: log2(Elems) steps, each one adding a copy of the partial sums shifted up by 2^step lanes
+    __aie_inline
+    static vector_type run_native(const vector_type &v)
+    {
+        const vector_type zero = zeros<T, Elems>::run();
+        vector_type ret = v;
+
+        utils::unroll_times<utils::log2(Elems)>([&](unsigned idx) __aie_inline {
+            ret = add<T, Elems>::run(ret, shuffle_up_fill<T, Elems>::run(ret, zero, 1u << idx));
+        });
+
+        return ret;
+    }
+
+    __aie_inline
+    static vector_type run_inclusive(const vector_type &v)
+    {
+        if constexpr (Elems <= native_elems) {
+            return run_native(v);
+        }
+        else {
+            // Scan each native chunk independently and propagate the running total across chunks, which avoids
+            // shuffling data across registers
+            using native_scan = scan_bits_impl<TypeBits, T, native_elems>;
+            constexpr unsigned num_ops = Elems / native_elems;
+
+            vector_type ret;
+
+            vector<T, native_elems> carry = zeros<T, native_elems>::run();
+
+            utils::unroll_times<num_ops>([&](unsigned idx) __aie_inline {
+                vector<T, native_elems> tmp = native_scan::run_native(v.template extract<native_elems>(idx));
+
+                if (idx > 0)
+                    tmp = add<T, native_elems>::run(tmp, carry);
+
+                carry = broadcast<T, native_elems>::run(tmp[native_elems - 1]);
+                ret.insert(idx, tmp);
+            });
+
+            return ret;
+        }
+    }
+
+    __aie_inline
+    static vector_type run_exclusive(const vector_type &v)
+    {
+        return run_inclusive(shuffle_up_fill<T, Elems>::run(v, zeros<T, Elems>::run(), 1));
+    }
+};
+
+template <typename T, unsigned Elems>
+using scan = scan_bits_impl<type_bits_v<T>, T, Elems>;
+
+template <AccumElemBaseType AccumTag, unsigned Elems>
+struct scan_accum_bits_impl;
+
+template <AccumElemBaseType AccumTag, unsigned Elems>
+using scan_accum = scan_accum_bits_impl<AccumTag, Elems>;
+
+}
+
+#if __AIE_ARCH__ == 20 || __AIE_ARCH__ == 21
+#include "aie2/scan.hpp"
+#endif
+
+#endif
@@ -0,0 +1,41 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2025 Advanced Micro Devices, Inc.
+
+#pragma once
+
+#ifndef __AIE_API_DETAIL_SOFTMAX__HPP__
+#define __AIE_API_DETAIL_SOFTMAX__HPP__
+
+#include "../activation.hpp"
+
+namespace aie::detail {
+
+// exp(x) with bfloat16 precision on float values, using the linear approximation of the activation functions
+template <unsigned Lanes> requires(Lanes == 16)
+class softmax_exp
+{
+public:
+    static constexpr unsigned lanes = Lanes;
+
+    __aie_inline
+    vector<float, lanes> run(const vector<float, lanes> &x)
+    {
+        const vector<bfloat16, lanes> e = exp_(accum<accfloat, lanes>(x).template to_vector<bfloat16>());
+
+        return aie::mul(e, bfloat16(1.0f)).template to_vector<float>();
+    }
+
+private:
+    aie::activation<activation_op::exp, bfloat16> exp_;
+};
+
+}
+
+#if __AIE_ARCH__ == 21
+
+#include "aie2p/softmax.hpp"
+
+#endif
+
+#endif
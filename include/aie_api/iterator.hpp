@@ -544,7 +544,6 @@ private:
     using         base_type = detail::unaligned_vector_iterator<T, Elems, Resource>;
     using         elem_type = aie_dm_resource_remove_t<T>;
     using       vector_type = detail::add_memory_bank_t<Resource, aie_dm_resource_set_t<vector<std::remove_const_t<elem_type>, Elems>, aie_dm_resource_get_v<T>>>;
-    using   vector_ref_type = unaligned_vector_ref<T, vector_type::size(), Resource>;
 
     __aie_inline
     unaligned_vector_iterator(const base_type &base) : base_type{base} {}
@@ -576,7 +575,7 @@ public:
 
     /** \brief Accesses the value in the iterator. */
     __aie_inline
-    vector_ref_type operator*() { return base_type::operator*(); }
+    typename base_type::reference operator*() { return base_type::operator*(); }
 
     /** \brief Accesses the value in the iterator. */
     __aie_inline
@@ -0,0 +1,334 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2025 Advanced Micro Devices, Inc.
+
+/**
+ * @file
+ * @brief Matrix layout conversion kernels.
+ */
+
+#pragma once
+
+#ifndef __AIE_API_LAYOUT__HPP__
+#define __AIE_API_LAYOUT__HPP__
+
+#include "aie.hpp"
+
+namespace aie::detail {
+
+// Transposes square blocks of B x B elements, whose rows are 128b vectors. Blocks that do not fit a 1024b register are
+// split in two halves of B / 2 rows, which are transposed separately and merged with interleave_zip: each output row is
+// made of B / 2 elements of each half.
+template <typename T>
+struct transpose_matrix
+{
+    static constexpr unsigned block  = 128 / type_bits_v<T>;
+    static constexpr unsigned splits = block * block * type_bits_v<T> > 1024? 2 : 1;
+    static constexpr unsigned part   = block / splits;
+
+    using row_type  = vector<T, block>;
+    using part_type = vector<T, block * part>;
+
+    template <typename InStream, typename OutStream>
+    __aie_inline
+    static void run(InStream &in, OutStream &out, unsigned num_blocks)
+    {
+        for (unsigned i = 0; i < num_blocks; ++i)
+            chess_prepare_for_pipelining
+            chess_loop_range(1,)
+        {
+            part_type parts[splits];
+
+            utils::unroll_times<splits>([&](auto s) __aie_inline {
+                utils::unroll_times<part>([&](auto r) __aie_inline {
+                    parts[s].insert(r, in.pop());
+                });
+
+                parts[s] = aie::transpose(parts[s], part, block);
+            });
+
+            if constexpr (splits == 2)
+                std::tie(parts[0], parts[1]) = aie::interleave_zip(parts[0], parts[1], part);
+
+            utils::unroll_times<splits>([&](auto s) __aie_inline {
+                utils::unroll_times<part>([&](auto r) __aie_inline {
+                    out.push(parts[s].template extract<block>(r));
+                });
+            });
+        }
+    }
+};
+
+// Conversion between row-major matrices and matrices stored as contiguous row-major tiles of Rows x Cols elements, with
+// tiles in row-major order. Strips of Rows rows and Rows * Cols columns are processed at once: each row of the strip is
+// loaded as a vector, and log2(Rows) rounds of interleave_zip reorder the Rows x Rows grid of row segments into Rows
+// consecutive tiles. Groups of Interleave rows within each tile are optionally interleaved element by element.
+template <typename T, unsigned Rows, unsigned Cols, unsigned Interleave>
+struct tile_matrix
+{
+    static constexpr unsigned tile_elems = Rows * Cols;
+    static constexpr unsigned rounds     = utils::log2(Rows);
+
+    using vector_type = vector<T, tile_elems>;
+
+    template <typename InStream>
+    __aie_inline
+    static void to_tiles(InStream &in, T * __restrict out, unsigned num_strips)
+    {
+        for (unsigned i = 0; i < num_strips; ++i)
+            chess_prepare_for_pipelining
+            chess_loop_range(1,)
+        {
+            vector_type v[Rows];
+
+            utils::unroll_times<Rows>([&](auto r) __aie_inline {
+                v[r] = in.pop();
+            });
+
+            // After each round, sets of 2 * m rows are merged with segments of 2 * m * Cols elements
+            utils::unroll_times<rounds>([&](auto round) __aie_inline {
+                constexpr unsigned m = 1u << round;
+                vector_type tmp[Rows];
+
+                utils::unroll_times<Rows / 2>([&](auto idx) __aie_inline {
+                    constexpr unsigned j = idx / m, k = idx % m;
+
+                    std::tie(tmp[2 * j * m + 2 * k], tmp[2 * j * m + 2 * k + 1]) = aie::interleave_zip(v[2 * j * m + k], v[(2 * j + 1) * m + k], m * Cols);
+                });
+
+                utils::unroll_times<Rows>([&](auto r) __aie_inline { v[r] = tmp[r]; });
+            });
+
+            utils::unroll_times<Rows>([&](auto r) __aie_inline {
+                aie::store_v(out, interleave_rows(v[r]));
+                out += tile_elems;
+            });
+        }
+    }
+
+    template <typename OutStream>
+    __aie_inline
+    static void from_tiles(const T * __restrict in, OutStream &out, unsigned num_strips)
+    {
+        for (unsigned i = 0; i < num_strips; ++i)
+            chess_prepare_for_pipelining
+            chess_loop_range(1,)
+        {
+            vector_type v[Rows];
+
+            utils::unroll_times<Rows>([&](auto r) __aie_inline {
+                v[r] = deinterleave_rows(aie::load_v<tile_elems>(in));
+                in += tile_elems;
+            });
+
+            // Rounds of to_tiles are undone in reverse order
+            utils::unroll_times<rounds>([&](auto round) __aie_inline {
+                constexpr unsigned m = Rows >> (round + 1);
+                vector_type tmp[Rows];
+
+                utils::unroll_times<Rows / 2>([&](auto idx) __aie_inline {
+                    constexpr unsigned j = idx / m, k = idx % m;
+
+                    std::tie(tmp[2 * j * m + k], tmp[(2 * j + 1) * m + k]) = aie::interleave_unzip(v[2 * j * m + 2 * k], v[2 * j * m + 2 * k + 1], m * Cols);
+                });
+
+                utils::unroll_times<Rows>([&](auto r) __aie_inline { v[r] = tmp[r]; });
+            });
+
+            utils::unroll_times<Rows>([&](auto r) __aie_inline {
+                out.push(v[r]);
+            });
+        }
+    }
+
+private:
+    __aie_inline
+    static vector_type interleave_rows(vector_type v)
+    {
+        if constexpr (Interleave > 1) {
+            utils::unroll_times<Rows / Interleave>([&](auto g) __aie_inline {
+                v.insert(g, aie::transpose(v.template extract<Interleave * Cols>(g), Interleave, Cols));
+            });
+        }
+
+        return v;
+    }
+
+    __aie_inline
+    static vector_type deinterleave_rows(vector_type v)
+    {
+        if constexpr (Interleave > 1) {
+            utils::unroll_times<Rows / Interleave>([&](auto g) __aie_inline {
+                v.insert(g, aie::transpose(v.template extract<Interleave * Cols>(g), Cols, Interleave));
+            });
+        }
+
+        return v;
+    }
+};
+
+} // namespace aie::detail
+
+namespace aie {
+
+/**
+ * @ingroup group_reshape
+ *
+ * Transposes a row-major matrix stored in a buffer, writing the result as a row-major matrix of cols x rows elements.
+ *
+ * The matrix is processed in square blocks whose rows are 128b vectors, that is 16 x 16 elements for 8b types, 8 x 8
+ * elements for 16b types and 4 x 4 elements for 32b types. Blocks are read and written with tensor buffer streams and
+ * transposed in registers with @ref transpose, which maps to the shuffle modes of the architecture. Blocks of 8b
+ * elements are transposed as two halves that are merged with @ref interleave_zip.
+ *
+ * @code
+ * // Layout change between two layers
+ * aie::transpose_matrix(act, 256, 256, act_t);
+ * @endcode
+ *
+ * @param in   Input matrix. Must meet the alignment requirements of a vector of 128b.
+ * @param rows Number of rows of the input matrix. Must be a non-zero multiple of the block size.
+ * @param cols Number of columns of the input matrix. Must be a non-zero multiple of the block size.
+ * @param out  Output matrix. Must meet the alignment requirements of a vector of 128b, and must not overlap the input.
+ *
+ * @tparam T Type of the elements. Must be 8b, 16b or 32b wide.
+ */
+template <ElemBaseType T>
+    requires(detail::type_bits_v<T> == 8 || detail::type_bits_v<T> == 16 || detail::type_bits_v<T> == 32)
+__aie_inline
+void transpose_matrix(const T * __restrict in, unsigned rows, unsigned cols, T * __restrict out)
+{
+    using impl = detail::transpose_matrix<T>;
+    constexpr unsigned B = impl::block;
+
+    REQUIRES_MSG(rows > 0 && rows % B == 0, "Number of rows must be a non-zero multiple of the block size");
+    REQUIRES_MSG(cols > 0 && cols % B == 0, "Number of columns must be a non-zero multiple of the block size");
+
+#if !AIE_API_DISABLE_ALIGNMENT_ASSERTIONS
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment<B>(in),  "Insufficient input alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment<B>(out), "Insufficient output alignment");
+#endif
+
+    // Steps are expressed in rows of a block. Blocks are visited in row-major order, and each block is read row by row
+    // and written column by column.
+    const unsigned in_row  = cols / B;
+    const unsigned out_row = rows / B;
+
+    const auto in_desc  = make_tensor_descriptor<T, B>(tensor_dim(rows / B, int(B * in_row)),
+                                                       tensor_dim(cols / B, 1),
+                                                       tensor_dim(B,        int(in_row)));
+    const auto out_desc = make_tensor_descriptor<T, B>(tensor_dim(rows / B, 1),
+                                                       tensor_dim(cols / B, int(B * out_row)),
+                                                       tensor_dim(B,        int(out_row)));
+
+    auto in_stream  = make_tensor_buffer_stream(in, in_desc);
+    auto out_stream = make_restrict_tensor_buffer_stream(out, out_desc);
+
+    impl::run(in_stream, out_stream, (rows / B) * (cols / B));
+}
+
+/**
+ * @ingroup group_reshape
+ *
+ * Converts a row-major matrix into the tiled layout expected by @ref aie::mmul: the matrix is stored as contiguous
+ * row-major tiles of Rows x Cols elements, and tiles are stored in row-major order.
+ *
+ * Strips of Rows rows and Rows * Cols columns are read with a tensor buffer stream, one vector per row, and reordered in
+ * registers into Rows consecutive tiles with log2(Rows) rounds of @ref interleave_zip. Tiles are written with vector
+ * stores.
+ *
+ * Interleave selects the VNNI-style layout used for the B operand of 8b and 4b types: groups of Interleave consecutive
+ * rows of each tile are interleaved element by element, so the Interleave elements of each column that are reduced
+ * together are contiguous. Tile groups are interleaved with @ref transpose.
+ *
+ * @code
+ * using MMUL = aie::mmul<4, 8, 8, int8, int8>;
+ *
+ * // GEMM prologue
+ * aie::tile_matrix<MMUL::M, MMUL::K>(a, rows_a, cols_a, a_tiled);
+ * aie::tile_matrix<MMUL::K, MMUL::N>(b, cols_a, cols_b, b_tiled);
+ * @endcode
+ *
+ * @tparam Rows       Number of rows of each tile. Must be a power of two.
+ * @tparam Cols       Number of columns of each tile.
+ * @tparam Interleave Number of rows interleaved within each tile. Must divide Rows.
+ *
+ * @param in   Input row-major matrix. Must meet the alignment requirements of a vector of Rows * Cols elements.
+ * @param rows Number of rows of the matrix. Must be a non-zero multiple of Rows.
+ * @param cols Number of columns of the matrix. Must be a non-zero multiple of Rows * Cols.
+ * @param out  Output tiled matrix. Must meet the alignment requirements of a vector of Rows * Cols elements, and must not
+ *             overlap the input.
+ */
+template <unsigned Rows, unsigned Cols, unsigned Interleave = 1, ElemBaseType T>
+    requires(detail::utils::is_powerof2(Rows) && Cols > 0 && Interleave > 0 && Rows % Interleave == 0)
+__aie_inline
+void tile_matrix(const T * __restrict in, unsigned rows, unsigned cols, T * __restrict out)
+{
+    using impl = detail::tile_matrix<T, Rows, Cols, Interleave>;
+    constexpr unsigned Elems = impl::tile_elems;
+
+    REQUIRES_MSG(rows > 0 && rows % Rows == 0,  "Number of rows must be a non-zero multiple of the tile rows");
+    REQUIRES_MSG(cols > 0 && cols % Elems == 0, "Number of columns must be a non-zero multiple of the tile size");
+
+#if !AIE_API_DISABLE_ALIGNMENT_ASSERTIONS
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment<Elems>(in),  "Insufficient input alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment<Elems>(out), "Insufficient output alignment");
+#endif
+
+    // Steps are expressed in vectors of a tile. Strips are visited in row-major order and read row by row.
+    const unsigned row = cols / Elems;
+
+    const auto desc = make_tensor_descriptor<T, Elems>(tensor_dim(rows / Rows, int(Rows * row)),
+                                                       tensor_dim(row,         1),
+                                                       tensor_dim(Rows,        int(row)));
+
+    auto stream = make_tensor_buffer_stream(in, desc);
+
+    impl::to_tiles(stream, out, (rows / Rows) * row);
+}
+
+/**
+ * @ingroup group_reshape
+ *
+ * Converts a matrix stored in the tiled layout produced by @ref tile_matrix back into a row-major matrix.
+ *
+ * @tparam Rows       Number of rows of each tile. Must be a power of two.
+ * @tparam Cols       Number of columns of each tile.
+ * @tparam Interleave Number of rows interleaved within each tile. Must divide Rows.
+ *
+ * @param in   Input tiled matrix. Must meet the alignment requirements of a vector of Rows * Cols elements.
+ * @param rows Number of rows of the matrix. Must be a non-zero multiple of Rows.
+ * @param cols Number of columns of the matrix. Must be a non-zero multiple of Rows * Cols.
+ * @param out  Output row-major matrix. Must meet the alignment requirements of a vector of Rows * Cols elements, and must
+ *             not overlap the input.
+ */
+template <unsigned Rows, unsigned Cols, unsigned Interleave = 1, ElemBaseType T>
+    requires(detail::utils::is_powerof2(Rows) && Cols > 0 && Interleave > 0 && Rows % Interleave == 0)
+__aie_inline
+void untile_matrix(const T * __restrict in, unsigned rows, unsigned cols, T * __restrict out)
+{
+    using impl = detail::tile_matrix<T, Rows, Cols, Interleave>;
+    constexpr unsigned Elems = impl::tile_elems;
+
+    REQUIRES_MSG(rows > 0 && rows % Rows == 0,  "Number of rows must be a non-zero multiple of the tile rows");
+    REQUIRES_MSG(cols > 0 && cols % Elems == 0, "Number of columns must be a non-zero multiple of the tile size");
+
+#if !AIE_API_DISABLE_ALIGNMENT_ASSERTIONS
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment<Elems>(in),  "Insufficient input alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment<Elems>(out), "Insufficient output alignment");
+#endif
+
+    const unsigned row = cols / Elems;
+
+    const auto desc = make_tensor_descriptor<T, Elems>(tensor_dim(rows / Rows, int(Rows * row)),
+                                                       tensor_dim(row,         1),
+                                                       tensor_dim(Rows,        int(row)));
+
+    auto stream = make_restrict_tensor_buffer_stream(out, desc);
+
+    impl::from_tiles(in, stream, (rows / Rows) * row);
+}
+
+} // namespace aie
+
+#endif
@@ -0,0 +1,225 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2025 Advanced Micro Devices, Inc.
+
+/**
+ * @file
+ * @brief Layer normalization kernels.
+ */
+
+#pragma once
+
+#ifndef __AIE_API_NORM__HPP__
+#define __AIE_API_NORM__HPP__
+
+#include "aie.hpp"
+
+namespace aie::detail {
+
+template <typename T, int FracBits>
+struct norm
+{
+    static constexpr unsigned lanes = 16;
+
+    // Integer values are accumulated exactly, floating-point values in single precision
+    using accum_tag = std::conditional_t<std::is_same_v<T, int16>, acc64, accfloat>;
+
+    // Returns the sum and the sum of squares of the input values, computed in a single pass. The sum is skipped when it
+    // is not needed.
+    template <bool WithSum>
+    __aie_inline
+    static std::pair<float, float> sums(const T *in, unsigned n)
+    {
+        accum<accum_tag, lanes> sum = aie::zeros<accum_tag, lanes>();
+        accum<accum_tag, lanes> sq  = aie::zeros<accum_tag, lanes>();
+
+        for (unsigned i = 0; i < n / lanes; ++i)
+            chess_prepare_for_pipelining
+            chess_loop_range(1,)
+        {
+            const vector<T, lanes> v = aie::load_v<lanes>(in);
+            in += lanes;
+
+            if constexpr (WithSum)
+                sum = aie::add(sum, v);
+
+            sq = aie::mac_square(sq, v);
+        }
+
+        if constexpr (std::is_same_v<T, int16>)
+            return { WithSum? aie::reduce_add(aie::to_float<float>(sum, FracBits)) : 0.0f,
+                     aie::reduce_add(aie::to_float<float>(sq, 2 * FracBits)) };
+        else
+            return { WithSum? aie::reduce_add(sum.template to_vector<float>()) : 0.0f,
+                     aie::reduce_add(sq.template to_vector<float>()) };
+    }
+
+    // Uses the vector implementation, which does not depend on a scalar math library
+    __aie_inline
+    static float rsqrt(float x)
+    {
+        return aie::invsqrt(broadcast<float, lanes>::run(x))[0];
+    }
+
+    // Computes (x * scale + bias) * gamma + beta
+    template <bool WithBeta>
+    __aie_inline
+    static void normalize(const T *in, unsigned n, float scale, float bias, const T *gamma, const T *beta, T *out)
+    {
+        const vector<float, lanes> scale_v = broadcast<float, lanes>::run(scale);
+
+        for (unsigned i = 0; i < n / lanes; ++i)
+            chess_prepare_for_pipelining
+            chess_loop_range(1,)
+        {
+            const accum<accfloat, lanes> b(broadcast<float, lanes>::run(bias));
+            const vector<float, lanes> xn = aie::mac(b, load(in), scale_v).template to_vector<float>();
+            in += lanes;
+
+            if constexpr (WithBeta) {
+                store(out, aie::mac(accum<accfloat, lanes>(load(beta)), xn, load(gamma)));
+                beta += lanes;
+            }
+            else {
+                store(out, aie::mul(xn, load(gamma)));
+            }
+
+            gamma += lanes;
+            out   += lanes;
+        }
+    }
+
+private:
+    __aie_inline
+    static vector<float, lanes> load(const T *p)
+    {
+        if constexpr (std::is_same_v<T, float>)
+            return aie::load_v<lanes>(p);
+        else if constexpr (std::is_same_v<T, bfloat16>)
+            return aie::mul(aie::load_v<lanes>(p), bfloat16(1.0f)).template to_vector<float>();
+        else
+            return aie::to_float<float>(aie::load_v<lanes>(p), FracBits);
+    }
+
+    __aie_inline
+    static void store(T *p, const accum<accfloat, lanes> &acc)
+    {
+        if constexpr (std::is_same_v<T, int16>)
+            aie::store_v(p, aie::to_fixed<int16>(acc.template to_vector<float>(), FracBits));
+        else
+            aie::store_v(p, acc.template to_vector<T>());
+    }
+};
+
+} // namespace aie::detail
+
+namespace aie {
+
+/**
+ * @ingroup group_nn
+ *
+ * Layer normalization over a buffer of values.
+ *
+ * @code
+ * mean   = sum(in[i]) / n;
+ * var    = sum(in[i] * in[i]) / n - mean * mean;
+ * out[i] = (in[i] - mean) / sqrt(var + epsilon) * gamma[i] + beta[i];
+ * @endcode
+ *
+ * The sum and the sum of squares are accumulated in a single pass over the input, into acc64 accumulators for int16
+ * values and into accfloat accumulators for floating-point values. A second pass normalizes the values with a
+ * reciprocal square root and applies gamma and beta. Normalization is computed in float.
+ *
+ * The variance is obtained from the sum of squares, so precision is lost when the mean is much larger than the standard
+ * deviation. Negative variances due to rounding are clamped to zero.
+ *
+ * int16 inputs, gamma, beta and outputs are fixed-point values with FracBits fractional bits. epsilon uses the same
+ * scale as the variance of the real values.
+ *
+ * @param in      Input values. Must meet the alignment requirements of a vector of 16 elements.
+ * @param n       Number of values. Must be a non-zero multiple of 16.
+ * @param gamma   Per-element scale, n values. Must meet the alignment requirements of a vector of 16 elements.
+ * @param beta    Per-element offset, n values. Must meet the alignment requirements of a vector of 16 elements.
+ * @param out     Output values. Must meet the alignment requirements of a vector of 16 elements.
+ * @param epsilon Value added to the variance.
+ *
+ * @tparam T        Type of the values. Must be float, bfloat16 or int16.
+ * @tparam FracBits Number of fractional bits of int16 values. Ignored for floating-point types.
+ */
+template <typename T, int FracBits = 12>
+    requires(arch::is(arch::Gen2) && Utils::is_one_of_v<T, float, bfloat16, int16>)
+__aie_inline
+void layer_norm(const T * __restrict in, unsigned n, const T * __restrict gamma, const T * __restrict beta,
+                T * __restrict out, float epsilon = 1e-5f)
+{
+    using impl = detail::norm<T, FracBits>;
+
+    REQUIRES_MSG(n > 0 && n % impl::lanes == 0, "Number of values must be a non-zero multiple of 16");
+
+#if !AIE_API_DISABLE_ALIGNMENT_ASSERTIONS
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment<impl::lanes>(in),    "Insufficient input alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment<impl::lanes>(gamma), "Insufficient gamma alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment<impl::lanes>(beta),  "Insufficient beta alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment<impl::lanes>(out),   "Insufficient output alignment");
+#endif
+
+    const auto [sum, sq] = impl::template sums<true>(in, n);
+
+    const float inv_n = 1.0f / n;
+    const float mean  = sum * inv_n;
+    const float var   = std::max(sq * inv_n - mean * mean, 0.0f);
+
+    // (x - mean) * rstd is computed as x * rstd - mean * rstd, with rstd = 1 / sqrt(var + epsilon)
+    const float rstd = impl::rsqrt(var + epsilon);
+
+    impl::template normalize<true>(in, n, rstd, -mean * rstd, gamma, beta, out);
+}
+
+/**
+ * @ingroup group_nn
+ *
+ * Root mean square normalization over a buffer of values.
+ *
+ * @code
+ * out[i] = in[i] / sqrt(sum(in[j] * in[j]) / n + epsilon) * gamma[i];
+ * @endcode
+ *
+ * The sum of squares is accumulated in a single pass over the input, into acc64 accumulators for int16 values and into
+ * accfloat accumulators for floating-point values. A second pass normalizes the values with a reciprocal square root
+ * and applies gamma. Normalization is computed in float.
+ *
+ * int16 inputs, gamma and outputs are fixed-point values with FracBits fractional bits.
+ *
+ * @param in      Input values. Must meet the alignment requirements of a vector of 16 elements.
+ * @param n       Number of values. Must be a non-zero multiple of 16.
+ * @param gamma   Per-element scale, n values. Must meet the alignment requirements of a vector of 16 elements.
+ * @param out     Output values. Must meet the alignment requirements of a vector of 16 elements.
+ * @param epsilon Value added to the mean of the squares.
+ *
+ * @tparam T        Type of the values. Must be float, bfloat16 or int16.
+ * @tparam FracBits Number of fractional bits of int16 values. Ignored for floating-point types.
+ */
+template <typename T, int FracBits = 12>
+    requires(arch::is(arch::Gen2) && Utils::is_one_of_v<T, float, bfloat16, int16>)
+__aie_inline
+void rms_norm(const T * __restrict in, unsigned n, const T * __restrict gamma, T * __restrict out,
+              float epsilon = 1e-5f)
+{
+    using impl = detail::norm<T, FracBits>;
+
+    REQUIRES_MSG(n > 0 && n % impl::lanes == 0, "Number of values must be a non-zero multiple of 16");
+
+#if !AIE_API_DISABLE_ALIGNMENT_ASSERTIONS
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment<impl::lanes>(in),    "Insufficient input alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment<impl::lanes>(gamma), "Insufficient gamma alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment<impl::lanes>(out),   "Insufficient output alignment");
+#endif
+
+    const auto [sum, sq] = impl::template sums<false>(in, n);
+
+    impl::template normalize<false>(in, n, impl::rsqrt(sq / n + epsilon), 0.0f, gamma, nullptr, out);
+}
+
+} // namespace aie
+
+#endif
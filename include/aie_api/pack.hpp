@@ -0,0 +1,186 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2025 Advanced Micro Devices, Inc.
+
+/**
+ * @file
+ * @brief Buffer packing and unpacking kernels.
+ */
+
+#pragma once
+
+#ifndef __AIE_API_PACK__HPP__
+#define __AIE_API_PACK__HPP__
+
+#include "aie.hpp"
+
+namespace aie::detail {
+
+template <typename T, unsigned Elems>
+struct pack_buffer
+{
+    // Pointers to 4b types address pairs of elements
+    template <typename U>
+    static constexpr unsigned ptr_step = type_bits_v<U> == 4? Elems / (sizeof(U) * 2) : Elems;
+
+    template <typename T2>
+    __aie_inline
+    static void unpack(const T *in, unsigned n, T2 *out)
+    {
+        for (unsigned i = 0; i < n / Elems; ++i)
+            chess_prepare_for_pipelining
+            chess_loop_range(1,)
+        {
+            aie::store_v(out, aie::unpack(aie::load_v<Elems>(in)));
+            in  += ptr_step<T>;
+            out += ptr_step<T2>;
+        }
+    }
+
+    template <typename T2>
+    __aie_inline
+    static void pack(const T *in, unsigned n, T2 *out)
+    {
+        for (unsigned i = 0; i < n / Elems; ++i)
+            chess_prepare_for_pipelining
+            chess_loop_range(1,)
+        {
+            aie::store_v(out, aie::pack(aie::load_v<Elems>(in)));
+            in  += ptr_step<T>;
+            out += ptr_step<T2>;
+        }
+    }
+
+    // Computes (x - zero_point) * scale as x * scale - zero_point * scale, so each element takes a single conversion and
+    // a single multiply-accumulate
+    template <typename TR>
+    __aie_inline
+    static void dequantize(const T *in, unsigned n, float scale, float zero_point, TR *out)
+    {
+        const vector<float, Elems> scale_v = broadcast<float, Elems>::run(scale);
+        const float bias = -zero_point * scale;
+
+        for (unsigned i = 0; i < n / Elems; ++i)
+            chess_prepare_for_pipelining
+            chess_loop_range(1,)
+        {
+            const accum<accfloat, Elems> b(broadcast<float, Elems>::run(bias));
+
+            aie::store_v(out, aie::mac(b, aie::to_float<float>(aie::load_v<Elems>(in)), scale_v).template to_vector<TR>());
+            in  += ptr_step<T>;
+            out += Elems;
+        }
+    }
+};
+
+} // namespace aie::detail
+
+namespace aie {
+
+/**
+ * @ingroup group_basic_types_conversion
+ *
+ * Converts a buffer of integer values to the next larger integer type, as @ref unpack does for a vector. For example,
+ * int4 weights can be expanded into int8 values.
+ *
+ * Loads, conversions and stores are software pipelined, so a vector of Elems elements is converted per iteration.
+ *
+ * @tparam Elems Number of elements converted per iteration.
+ *
+ * @param in  Input buffer. Must meet the alignment requirements of a vector of Elems elements.
+ * @param n   Number of elements. Must be a non-zero multiple of Elems.
+ * @param out Output buffer. Must meet the alignment requirements of a vector of Elems elements.
+ */
+template <unsigned Elems, ElemBaseType T, ElemBaseType T2>
+    requires(!detail::is_floating_point_v<T> && std::is_same_v<T2, Utils::get_next_integer_type_t<T>>)
+__aie_inline
+void unpack_buffer(const T * __restrict in, unsigned n, T2 * __restrict out)
+{
+    REQUIRES_MSG(n > 0 && n % Elems == 0, "Number of elements must be a non-zero multiple of the vector size");
+
+#if !AIE_API_DISABLE_ALIGNMENT_ASSERTIONS
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment<Elems>(in),  "Insufficient input alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment<Elems>(out), "Insufficient output alignment");
+#endif
+
+    detail::pack_buffer<T, Elems>::unpack(in, n, out);
+}
+
+/**
+ * @ingroup group_basic_types_conversion
+ *
+ * Converts a buffer of integer values to the next smaller integer type, as @ref pack does for a vector. For example,
+ * int8 weights can be compressed into int4 values for storage.
+ *
+ * Loads, conversions and stores are software pipelined, so a vector of Elems elements is converted per iteration.
+ *
+ * @tparam Elems Number of elements converted per iteration.
+ *
+ * @param in  Input buffer. Must meet the alignment requirements of a vector of Elems elements.
+ * @param n   Number of elements. Must be a non-zero multiple of Elems.
+ * @param out Output buffer. Must meet the alignment requirements of a vector of Elems elements.
+ */
+template <unsigned Elems, ElemBaseType T, ElemBaseType T2>
+    requires(!detail::is_floating_point_v<T> && std::is_same_v<T2, Utils::get_prev_integer_type_t<T>>)
+__aie_inline
+void pack_buffer(const T * __restrict in, unsigned n, T2 * __restrict out)
+{
+    REQUIRES_MSG(n > 0 && n % Elems == 0, "Number of elements must be a non-zero multiple of the vector size");
+
+#if !AIE_API_DISABLE_ALIGNMENT_ASSERTIONS
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment<Elems>(in),  "Insufficient input alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment<Elems>(out), "Insufficient output alignment");
+#endif
+
+    detail::pack_buffer<T, Elems>::pack(in, n, out);
+}
+
+/**
+ * @ingroup group_basic_types_conversion
+ *
+ * Dequantizes a buffer of integer values with a scale and an optional zero point per group of consecutive elements.
+ *
+ * @code
+ * out[i] = (in[i] - zero_points[i / group_size]) * scales[i / group_size];
+ * @endcode
+ *
+ * Values are converted to float with @ref to_float and scaled with a single multiply-accumulate, so 4b and 8b weights
+ * can be expanded at layer start without intermediate buffers.
+ *
+ * @tparam Elems Number of elements converted per iteration.
+ * @tparam TR    Type of the output values. Must be float or bfloat16.
+ *
+ * @param in          Input buffer. Must meet the alignment requirements of a vector of Elems elements.
+ * @param n           Number of elements. Must be a non-zero multiple of group_size.
+ * @param group_size  Number of elements that share a scale and a zero point. Must be a non-zero multiple of Elems.
+ * @param scales      Scale of each group, n / group_size values.
+ * @param zero_points Zero point of each group, n / group_size values. A null pointer means that all zero points are 0.
+ * @param out         Output buffer. Must meet the alignment requirements of a vector of Elems elements.
+ */
+template <unsigned Elems, ElemBaseType TR, ElemBaseType T>
+    requires(arch::is(arch::Gen2) && Utils::is_one_of_v<T, int4, uint4, int8, uint8> && Utils::is_one_of_v<TR, float, bfloat16>)
+__aie_inline
+void unpack_buffer(const T * __restrict in, unsigned n, unsigned group_size, const float *scales, const float *zero_points,
+                   TR * __restrict out)
+{
+    using impl = detail::pack_buffer<T, Elems>;
+
+    REQUIRES_MSG(group_size > 0 && group_size % Elems == 0, "Group size must be a non-zero multiple of the vector size");
+    REQUIRES_MSG(n > 0 && n % group_size == 0, "Number of elements must be a non-zero multiple of the group size");
+
+#if !AIE_API_DISABLE_ALIGNMENT_ASSERTIONS
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment<Elems>(in),  "Insufficient input alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment<Elems>(out), "Insufficient output alignment");
+#endif
+
+    for (unsigned g = 0; g < n / group_size; ++g) {
+        impl::dequantize(in, group_size, scales[g], zero_points? zero_points[g] : 0.0f, out);
+
+        in  += (group_size / Elems) * impl::template ptr_step<T>;
+        out += group_size;
+    }
+}
+
+} // namespace aie
+
+#endif
@@ -0,0 +1,148 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2025 Advanced Micro Devices, Inc.
+
+/**
+ * @file
+ * @brief Softmax kernel.
+ */
+
+#pragma once
+
+#ifndef __AIE_API_SOFTMAX__HPP__
+#define __AIE_API_SOFTMAX__HPP__
+
+#include "aie.hpp"
+#include "detail/softmax.hpp"
+
+namespace aie {
+
+/**
+ * @ingroup group_nn
+ *
+ * Numerically stable softmax over a buffer of values.
+ *
+ * @code
+ * out[i] = exp(in[i] - max(in)) / sum(exp(in[j] - max(in)) for j in [0, n));
+ * @endcode
+ *
+ * The kernel reads the input twice. The first pass is an online softmax: each lane keeps a running maximum and a
+ * running sum of exponentials, and rescales the sum by exp(old_max - new_max) whenever its maximum grows. This fuses
+ * the maximum, subtraction, exponential and sum into a single pass. Per-lane results are then combined into the row
+ * maximum and sum. The second pass recomputes the exponentials and multiplies them by the reciprocal of the sum.
+ *
+ * Computations are done in float with bfloat16 precision exponentials, so results of float inputs have a relative error
+ * close to the bfloat16 precision.
+ *
+ * int8 inputs are fixed-point values with InFracBits fractional bits, and int8 outputs are probabilities in Q.7 format
+ * saturated to 127.
+ *
+ * @code
+ * aie::softmax<bfloat16> softmax;
+ *
+ * for (unsigned row = 0; row < rows; ++row)
+ *     softmax.run(in + row * cols, cols, out + row * cols);
+ * @endcode
+ *
+ * \note
+ * Objects keep internal state for the exponential approximation and cannot be copied.
+ *
+ * @tparam T          Type of the input and output values. Must be float, bfloat16 or int8.
+ * @tparam InFracBits Number of fractional bits of int8 inputs. Ignored for floating-point types.
+ */
+template <typename T, int InFracBits = 0>
+    requires(arch::is(arch::Gen2) && Utils::is_one_of_v<T, float, bfloat16, int8>)
+class softmax
+{
+public:
+    /**
+     * \brief Number of elements processed per step.
+     */
+    static constexpr unsigned lanes = 16;
+
+    softmax() = default;
+
+    softmax(const softmax &) = delete;
+    softmax &operator=(const softmax &) = delete;
+
+    /**
+     * \brief Computes the softmax of a buffer.
+     *
+     * @param in  Input values. Must meet the alignment requirements of a vector of lanes elements.
+     * @param n   Number of values. Must be a non-zero multiple of lanes.
+     * @param out Output values. Must meet the alignment requirements of a vector of lanes elements.
+     */
+    __aie_inline
+    void run(const T * __restrict in, unsigned n, T * __restrict out)
+    {
+        REQUIRES_MSG(n > 0 && n % lanes == 0, "Number of values must be a non-zero multiple of lanes");
+
+#if !AIE_API_DISABLE_ALIGNMENT_ASSERTIONS
+        RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment<lanes>(in),  "Insufficient input alignment");
+        RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment<lanes>(out), "Insufficient output alignment");
+#endif
+
+        const T *p = in;
+
+        // Lanes are initialized with the first vector, whose exponentials relative to itself are one
+        vector<float, lanes> m = load(p);
+        vector<float, lanes> s = broadcast<float, lanes>(1.0f);
+        p += lanes;
+
+        for (unsigned i = 1; i < n / lanes; ++i)
+            chess_prepare_for_pipelining
+        {
+            const vector<float, lanes> x = load(p);
+            p += lanes;
+
+            const vector<float, lanes> m_new = aie::max(m, x);
+            const vector<float, lanes> scale = exp_.run(aie::sub(m, m_new));
+            const vector<float, lanes> e     = exp_.run(aie::sub(x, m_new));
+
+            s = mac(accum<accfloat, lanes>(e), s, scale).template to_vector<float>();
+            m = m_new;
+        }
+
+        const float max   = reduce_max(m);
+        const float total = reduce_add(mul(s, exp_.run(aie::sub(m, max))).template to_vector<float>());
+        const float inv   = 1.0f / total;
+
+        for (unsigned i = 0; i < n / lanes; ++i)
+            chess_prepare_for_pipelining
+            chess_loop_range(1,)
+        {
+            const vector<float, lanes> e = exp_.run(aie::sub(load(in), max));
+            in += lanes;
+
+            store(out, mul(e, inv));
+            out += lanes;
+        }
+    }
+
+private:
+    __aie_inline
+    static vector<float, lanes> load(const T *p)
+    {
+        if constexpr (std::is_same_v<T, float>)
+            return load_v<lanes>(p);
+        else if constexpr (std::is_same_v<T, bfloat16>)
+            return mul(load_v<lanes>(p), bfloat16(1.0f)).template to_vector<float>();
+        else
+            return to_float<float>(load_v<lanes>(p), InFracBits);
+    }
+
+    __aie_inline
+    static void store(T *p, const accum<accfloat, lanes> &acc)
+    {
+        if constexpr (std::is_same_v<T, int8>)
+            store_v(p, to_fixed<int8>(aie::min(acc.template to_vector<float>(), 0.9921875f), 7));
+        else
+            store_v(p, acc.template to_vector<T>());
+    }
+
+    detail::softmax_exp<lanes> exp_;
+};
+
+} // namespace aie
+
+#endif
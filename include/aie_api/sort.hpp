@@ -0,0 +1,248 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2025 Advanced Micro Devices, Inc.
+
+/**
+ * @file
+ * @brief Sorting networks for vectors and buffers.
+ */
+
+#pragma once
+
+#ifndef __AIE_API_SORT__HPP__
+#define __AIE_API_SORT__HPP__
+
+#include "aie.hpp"
+
+namespace aie::detail {
+
+// Bitonic sorting network on the lanes of a vector. Each step compares the elements at a given distance: the vector is
+// split with interleave_unzip into the elements of the lower and upper half of each pair, min and max are computed, and
+// the results are put back in place with interleave_zip.
+template <typename T, unsigned Elems>
+struct bitonic_sort
+{
+    using vector_type = vector<T, Elems>;
+    using half_type   = vector<T, Elems / 2>;
+
+    // Lanes of the lower half of the pairs that belong to blocks sorted in descending order
+    static constexpr mask<Elems / 2> descending_lanes(unsigned block, unsigned dist)
+    {
+        mask<Elems / 2> m;
+
+        for (unsigned p = 0; p < Elems / 2; ++p) {
+            const unsigned i = (p / dist) * 2 * dist + p % dist;
+
+            if (i & block)
+                m.set(p);
+        }
+
+        return m;
+    }
+
+    // Compare-exchange step at distance Dist while building sorted blocks of Block elements. Blocks alternate between
+    // ascending and descending order, except for the last stage in which Block == Elems.
+    template <unsigned Block, unsigned Dist>
+    __aie_inline
+    static vector_type step(const vector_type &v)
+    {
+        half_type a, b;
+
+        if constexpr (Dist == Elems / 2) {
+            a = v.template extract<Elems / 2>(0);
+            b = v.template extract<Elems / 2>(1);
+        }
+        else {
+            std::tie(a, b) = aie::interleave_unzip(v.template extract<Elems / 2>(0), v.template extract<Elems / 2>(1), Dist);
+        }
+
+        half_type lo = aie::min(a, b);
+        half_type hi = aie::max(a, b);
+
+        if constexpr (Block < Elems) {
+            constexpr mask<Elems / 2> desc = descending_lanes(Block, Dist);
+
+            a = aie::select(lo, hi, desc);
+            b = aie::select(hi, lo, desc);
+        }
+        else {
+            a = lo;
+            b = hi;
+        }
+
+        if constexpr (Dist == Elems / 2)
+            return aie::concat(a, b);
+        else
+            return aie::concat(aie::interleave_zip(a, b, Dist));
+    }
+
+    __aie_inline
+    static vector_type run(vector_type v)
+    {
+        utils::unroll_times<utils::log2(Elems)>([&](auto stage) __aie_inline {
+            constexpr unsigned block = 2u << stage;
+
+            utils::unroll_times<stage + 1>([&](auto sub) __aie_inline {
+                v = step<block, (block >> (sub + 1))>(v);
+            });
+        });
+
+        return v;
+    }
+
+    // Merges two sorted vectors. Reversing the second one makes their concatenation a bitonic sequence, which is split
+    // into its lower and upper halves, both also bitonic, and then sorted with the last stage of the network.
+    __aie_inline
+    static std::pair<vector_type, vector_type> merge(const vector_type &v1, const vector_type &v2)
+    {
+        const vector_type r = aie::reverse(v2);
+
+        vector_type lo = aie::min(v1, r);
+        vector_type hi = aie::max(v1, r);
+
+        utils::unroll_times<utils::log2(Elems)>([&](auto sub) __aie_inline {
+            lo = step<Elems, (Elems >> (sub + 1))>(lo);
+            hi = step<Elems, (Elems >> (sub + 1))>(hi);
+        });
+
+        return { lo, hi };
+    }
+
+    // Merges two sorted runs, whose sizes are non-zero multiples of Elems. Two vectors are kept in registers: each step
+    // merges them, stores the lower half, and replaces it with the next vector of the run with the smallest head.
+    __aie_inline
+    static void merge_runs(const T *in1, unsigned n1, const T *in2, unsigned n2, T *out)
+    {
+        const T *end1 = in1 + n1;
+        const T *end2 = in2 + n2;
+
+        vector_type v1 = aie::load_v<Elems>(in1); in1 += Elems;
+        vector_type v2 = aie::load_v<Elems>(in2); in2 += Elems;
+
+        for (unsigned i = 0; i < (n1 + n2) / Elems - 2; ++i)
+            chess_prepare_for_pipelining
+        {
+            const auto [lo, hi] = merge(v1, v2);
+
+            aie::store_v(out, lo);
+            out += Elems;
+
+            if (in2 == end2 || (in1 != end1 && *in1 <= *in2)) {
+                v1 = aie::load_v<Elems>(in1);
+                in1 += Elems;
+            }
+            else {
+                v1 = aie::load_v<Elems>(in2);
+                in2 += Elems;
+            }
+
+            v2 = hi;
+        }
+
+        const auto [lo, hi] = merge(v1, v2);
+
+        aie::store_v(out, lo);
+        aie::store_v(out + Elems, hi);
+    }
+
+    __aie_inline
+    static void copy(const T *in, unsigned n, T *out)
+    {
+        for (unsigned i = 0; i < n / Elems; ++i)
+            chess_prepare_for_pipelining
+        {
+            aie::store_v(out, aie::load_v<Elems>(in));
+            in  += Elems;
+            out += Elems;
+        }
+    }
+};
+
+} // namespace aie::detail
+
+namespace aie {
+
+/**
+ * @ingroup group_reshape
+ *
+ * Returns a vector with the elements of the input vector sorted in ascending order.
+ *
+ * The vector is sorted in registers with a bitonic network of log2(Elems) * (log2(Elems) + 1) / 2 compare-exchange
+ * steps, each one made of an @ref interleave_unzip, a @ref min, a @ref max and an @ref interleave_zip.
+ *
+ * @param v Input vector. The type must meet @ref aie::RealVector, its size must be a power of two, it must be at least
+ *          256b wide and elements must be at least 8 bits wide.
+ */
+template <RealVector Vec>
+    requires(Vec::bits() >= 256 && detail::utils::is_powerof2(Vec::size()) && detail::type_bits_v<typename Vec::value_type> >= 8)
+__aie_inline
+auto sort(const Vec &v) -> aie_dm_resource_remove_t<Vec>
+{
+    using T = typename Vec::value_type;
+    constexpr unsigned Elems = Vec::size();
+
+    return detail::bitonic_sort<T, Elems>::run(v);
+}
+
+/**
+ * @ingroup group_reshape
+ *
+ * Sorts a buffer in ascending order.
+ *
+ * Each vector of Elems elements is first sorted in registers with @ref sort. Sorted runs are then merged in
+ * log2(n / Elems) passes that alternate between the buffer and a temporary buffer. Runs are merged with a bitonic merge
+ * network, so each step produces a whole vector of output elements. The sorted values are always returned in the input
+ * buffer.
+ *
+ * @tparam Elems Number of elements processed per step. Must be a power of two, and vectors of Elems elements must be
+ *               at least 256b wide.
+ *
+ * @param data Buffer to sort. Must meet the alignment requirements of a vector of Elems elements.
+ * @param n    Number of elements. Must be a non-zero multiple of Elems.
+ * @param tmp  Temporary buffer of n elements. Must meet the alignment requirements of a vector of Elems elements.
+ */
+template <unsigned Elems, ElemBaseType T>
+    requires(!detail::is_complex_v<T> && Elems * detail::type_bits_v<T> >= 256 && detail::utils::is_powerof2(Elems) && detail::type_bits_v<T> >= 8)
+__aie_inline
+void sort(T * __restrict data, unsigned n, T * __restrict tmp)
+{
+    using impl = detail::bitonic_sort<T, Elems>;
+
+    REQUIRES_MSG(n > 0 && n % Elems == 0, "Number of elements must be a non-zero multiple of the vector size");
+
+#if !AIE_API_DISABLE_ALIGNMENT_ASSERTIONS
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment<Elems>(data), "Insufficient data alignment");
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment<Elems>(tmp),  "Insufficient temporary buffer alignment");
+#endif
+
+    for (unsigned i = 0; i < n; i += Elems)
+        chess_prepare_for_pipelining
+    {
+        store_v(data + i, impl::run(load_v<Elems>(data + i)));
+    }
+
+    T *src = data;
+    T *dst = tmp;
+
+    for (unsigned width = Elems; width < n; width *= 2) {
+        for (unsigned start = 0; start < n; start += 2 * width) {
+            const unsigned n1 = n - start < width? n - start : width;
+            const unsigned n2 = n - start - n1 < width? n - start - n1 : width;
+
+            // The last run of a pass may have no pair
+            if (n2 == 0)
+                impl::copy(src + start, n1, dst + start);
+            else
+                impl::merge_runs(src + start, n1, src + start + n1, n2, dst + start);
+        }
+
+        std::swap(src, dst);
+    }
+
+    if (src != data)
+        impl::copy(src, n, data);
+}
+
+} // namespace aie
+
+#endif
@@ -0,0 +1,267 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2025 Advanced Micro Devices, Inc.
+
+/**
+ * @file
+ * @brief Goertzel and sliding DFT kernels for the evaluation of a small set of frequency bins.
+ */
+
+#pragma once
+
+#ifndef __AIE_API_SPECTRAL__HPP__
+#define __AIE_API_SPECTRAL__HPP__
+
+#include "aie.hpp"
+
+namespace aie::detail {
+
+static constexpr float spectral_two_pi = 6.28318530718f;
+
+} // namespace aie::detail
+
+namespace aie {
+
+/**
+ * @ingroup group_dsp
+ *
+ * Evaluates Bins frequency bins of a real signal with the Goertzel algorithm. Each bin is assigned to a vector lane,
+ * so every input sample updates all bins with a single multiply-accumulate:
+ *
+ * @code
+ * for (unsigned k = 0; k < Bins; ++k)
+ *     s0[k] = x[n] + 2 * cos(w[k]) * s1[k] - s2[k];
+ * @endcode
+ *
+ * Bin frequencies are arbitrary, they do not need to be integer multiples of the inverse of the block length.
+ * Samples can be pushed across multiple calls to @ref run, and the bin powers are read with @ref power at the end of
+ * the analysis window.
+ *
+ * @code
+ * const float freqs[8] = { 697.f / fs, 770.f / fs, 852.f / fs, 941.f / fs,
+ *                          1209.f / fs, 1336.f / fs, 1477.f / fs, 1633.f / fs };
+ *
+ * aie::goertzel<8> dtmf(freqs);
+ *
+ * dtmf.run(in, 205);
+ * aie::vector<float, 8> p = dtmf.power();
+ * @endcode
+ *
+ * @tparam Bins Number of bins evaluated in parallel. Must be 8, 16 or 32.
+ */
+template <unsigned Bins = native_vector_length_v<float>> requires(Bins == 8 || Bins == 16 || Bins == 32)
+class goertzel
+{
+public:
+    using vector_type = vector<float, Bins>;
+
+    /**
+     * \brief Constructor.
+     *
+     * @param freqs Frequency of each bin, normalized to the sampling rate (cycles per sample).
+     */
+    goertzel(const float *freqs)
+    {
+        for (unsigned k = 0; k < Bins; ++k)
+            coeff_.set(2.0f * std::cos(detail::spectral_two_pi * freqs[k]), k);
+
+        reset();
+    }
+
+    /**
+     * \brief Constructor from precomputed coefficients.
+     *
+     * @param coeff Vector with the 2 * cos(2 * pi * f) coefficient of each bin.
+     */
+    __aie_inline
+    goertzel(const vector_type &coeff) : coeff_(coeff)
+    {
+        reset();
+    }
+
+    /**
+     * \brief Clears the filter state, starting a new analysis window.
+     */
+    __aie_inline
+    void reset()
+    {
+        s1_ = zeros<float, Bins>();
+        s2_ = zeros<float, Bins>();
+    }
+
+    /**
+     * \brief Updates all bins with a block of samples.
+     *
+     * @param in Input samples. Supported types are int16, int32 and float.
+     * @param n  Number of samples.
+     */
+    template <typename T> requires(Utils::is_one_of_v<T, int16, int32, float>)
+    __aie_inline
+    void run(const T * __restrict in, unsigned n)
+    {
+        vector_type s1 = s1_;
+        vector_type s2 = s2_;
+
+        for (unsigned i = 0; i < n; ++i)
+            chess_prepare_for_pipelining
+        {
+            const accum<accfloat, Bins> acc(sub((float)in[i], s2));
+            const vector_type s0 = mac(acc, coeff_, s1).template to_vector<float>();
+
+            s2 = s1;
+            s1 = s0;
+        }
+
+        s1_ = s1;
+        s2_ = s2;
+    }
+
+    /**
+     * \brief Returns the power of each bin at the current point of the analysis window.
+     *
+     * @code
+     * for (unsigned k = 0; k < Bins; ++k)
+     *     out[k] = s1[k] * s1[k] + s2[k] * s2[k] - 2 * cos(w[k]) * s1[k] * s2[k];
+     * @endcode
+     */
+    __aie_inline
+    vector_type power() const
+    {
+        const vector_type cross = mul(s1_, s2_).template to_vector<float>();
+
+        accum<accfloat, Bins> acc = mul_square(s1_);
+        acc = mac_square(acc, s2_);
+        acc = msc(acc, coeff_, cross);
+
+        return acc.template to_vector<float>();
+    }
+
+private:
+    vector_type coeff_;
+    vector_type s1_;
+    vector_type s2_;
+};
+
+/**
+ * @ingroup group_dsp
+ *
+ * Sliding DFT of length N evaluated on Bins frequency bins of a real signal. Each bin is assigned to a vector lane and
+ * updated on every input sample:
+ *
+ * @code
+ * for (unsigned k = 0; k < Bins; ++k)
+ *     X[k] = (X[k] + x[n] - r^N * x[n - N]) * r * exp(j * 2 * pi * bin[k] / N);
+ * @endcode
+ *
+ * The damping factor r, slightly smaller than one, keeps the recursion stable in the presence of rounding errors. Bin
+ * state is kept in real and imaginary float vectors, which are rotated with floating-point multiply-accumulate
+ * operations, so the same implementation is used on all architectures.
+ *
+ * @tparam Bins Number of bins evaluated in parallel. Must be 8, 16 or 32.
+ */
+template <unsigned Bins = native_vector_length_v<float>> requires(Bins == 8 || Bins == 16 || Bins == 32)
+class sliding_dft
+{
+public:
+    using vector_type = vector<float, Bins>;
+
+    /**
+     * \brief Constructor.
+     *
+     * @param bins    Index of each DFT bin, in the [0, N) range.
+     * @param N       DFT length.
+     * @param damping Damping factor r applied to each update.
+     */
+    sliding_dft(const unsigned *bins, unsigned N, float damping = 0.99999f) : N_(N)
+    {
+        for (unsigned k = 0; k < Bins; ++k) {
+            const float w = detail::spectral_two_pi * float(bins[k]) / float(N);
+
+            cos_.set(damping * std::cos(w), k);
+            sin_.set(damping * std::sin(w), k);
+        }
+
+        comb_ = std::pow(damping, float(N));
+
+        reset();
+    }
+
+    /**
+     * \brief Clears the bin state.
+     */
+    __aie_inline
+    void reset()
+    {
+        re_ = zeros<float, Bins>();
+        im_ = zeros<float, Bins>();
+    }
+
+    /**
+     * \brief Updates all bins with a block of samples.
+     *
+     * @param in Input samples. The N samples that precede in (in[-N] to in[-1]) must hold the signal history, which is
+     *           zero at the beginning of the stream. Supported types are int16, int32 and float.
+     * @param n  Number of samples.
+     */
+    template <typename T> requires(Utils::is_one_of_v<T, int16, int32, float>)
+    __aie_inline
+    void run(const T * __restrict in, unsigned n)
+    {
+        vector_type re = re_;
+        vector_type im = im_;
+
+        const T * __restrict old = in - N_;
+
+        for (unsigned i = 0; i < n; ++i)
+            chess_prepare_for_pipelining
+        {
+            const float delta = (float)in[i] - comb_ * (float)old[i];
+            const vector_type a = add(re, delta);
+
+            re = msc(mul(a, cos_), im, sin_).template to_vector<float>();
+            im = mac(mul(a, sin_), im, cos_).template to_vector<float>();
+        }
+
+        re_ = re;
+        im_ = im;
+    }
+
+    /**
+     * \brief Returns the real part of each bin.
+     */
+    __aie_inline
+    vector_type real() const
+    {
+        return re_;
+    }
+
+    /**
+     * \brief Returns the imaginary part of each bin.
+     */
+    __aie_inline
+    vector_type imag() const
+    {
+        return im_;
+    }
+
+    /**
+     * \brief Returns the power of each bin.
+     */
+    __aie_inline
+    vector_type power() const
+    {
+        return mac_square(mul_square(re_), im_).template to_vector<float>();
+    }
+
+private:
+    vector_type cos_;
+    vector_type sin_;
+    vector_type re_;
+    vector_type im_;
+    float       comb_;
+    unsigned    N_;
+};
+
+} // namespace aie
+
+#endif
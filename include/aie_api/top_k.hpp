@@ -0,0 +1,185 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2022 Xilinx, Inc.
+// Copyright (C) 2022-2025 Advanced Micro Devices, Inc.
+
+/**
+ * @file
+ * @brief Top-k selection kernels.
+ */
+
+#pragma once
+
+#ifndef __AIE_API_TOP_K__HPP__
+#define __AIE_API_TOP_K__HPP__
+
+#include "aie.hpp"
+
+namespace aie::detail {
+
+// Keeps the K largest values seen by each lane, sorted in descending order across K rows of vectors, together with the
+// iteration in which each value was loaded. Equal values keep their arrival order, so the first occurrence of a value
+// always precedes later ones.
+template <unsigned K, typename T, unsigned Elems>
+struct top_k
+{
+    using vector_type = vector<T, Elems>;
+    using index_type  = vector<int16, Elems>;
+
+    using result_type = std::pair<std::array<T, K>, std::array<unsigned, K>>;
+
+    // Larger than any iteration index, so that padding loses ties against real values
+    static constexpr int16 index_sentinel = 32767;
+
+    // Not larger than any input value, including -inf for floating-point types
+    __aie_inline
+    static T padding()
+    {
+        if constexpr (is_floating_point_v<T>)
+            return -std::numeric_limits<T>::infinity();
+        else
+            return std::numeric_limits<T>::lowest();
+    }
+
+    vector_type values[K];
+    index_type  indices[K];
+
+    // Inserts a vector into the first Rows rows of each lane with a chain of compare-exchange steps. The smallest value
+    // is pushed out of the last row, or stored into row Rows when it is still empty.
+    template <unsigned Rows, bool Grow>
+    __aie_inline
+    void insert(vector_type x, index_type xi)
+    {
+        utils::unroll_times<Rows>([&](auto row) __aie_inline {
+            // The mask is set where the incoming value is strictly larger and moves up
+            const auto [hi, up] = aie::max_cmp(values[row], x);
+
+            const vector_type lo    = aie::select(x, values[row], up);
+            const index_type  lo_i  = aie::select(xi, indices[row], up);
+
+            indices[row] = aie::select(indices[row], xi, up);
+            values[row]  = hi;
+            x            = lo;
+            xi           = lo_i;
+        });
+
+        if constexpr (Grow) {
+            values[Rows]  = x;
+            indices[Rows] = xi;
+        }
+    }
+
+    // Extracts the K largest values from the rows. The first row holds the largest value of each lane, so each step
+    // selects the best lane and shifts its remaining values up by one row.
+    template <unsigned Rows>
+    __aie_inline
+    result_type extract()
+    {
+        result_type ret;
+
+        for (unsigned k = 0; k < K; ++k) {
+            const T           max   = aie::reduce_max(values[0]);
+            const mask<Elems> hit   = aie::eq(values[0], max);
+            const int16       first = aie::reduce_min(aie::select(aie::broadcast<int16, Elems>(index_sentinel), indices[0], hit));
+            const unsigned    lane  = first_set_lane(hit & aie::eq(indices[0], first));
+
+            ret.first[k]  = max;
+            ret.second[k] = unsigned(first) * Elems + lane;
+
+            mask<Elems> pop;
+            pop.set(lane);
+
+            utils::unroll_times<Rows - 1>([&](auto row) __aie_inline {
+                values[row]  = aie::select(values[row],  values[row + 1],  pop);
+                indices[row] = aie::select(indices[row], indices[row + 1], pop);
+            });
+
+            values[Rows - 1]  = aie::select(values[Rows - 1],  aie::broadcast<T, Elems>(padding()), pop);
+            indices[Rows - 1] = aie::select(indices[Rows - 1], aie::broadcast<int16, Elems>(index_sentinel), pop);
+        }
+
+        return ret;
+    }
+};
+
+} // namespace aie::detail
+
+namespace aie {
+
+/**
+ * @ingroup group_reduce
+ *
+ * Returns the K largest values of the input vector in descending order, and the indices of the lanes that hold them.
+ * Equal values are returned in lane order. The input must not contain NaN values, otherwise the result is unspecified.
+ *
+ * @tparam K Number of values to return. Must not be larger than the size of the vector.
+ *
+ * @param v Input vector. The type must meet @ref aie::RealVector.
+ */
+template <unsigned K, RealVector Vec> requires(K > 0 && K <= Vec::size())
+__aie_inline
+auto top_k(const Vec &v) -> std::pair<std::array<typename Vec::value_type, K>, std::array<unsigned, K>>
+{
+    using T = typename Vec::value_type;
+    constexpr unsigned Elems = Vec::size();
+
+    detail::top_k<K, T, Elems> state;
+
+    state.values[0]  = v;
+    state.indices[0] = zeros<int16, Elems>();
+
+    return state.template extract<1>();
+}
+
+/**
+ * @ingroup group_reduce
+ *
+ * Returns the K largest values of a buffer in descending order, and their indices in the buffer. Equal values are
+ * returned in order of occurrence. The input must not contain NaN values, otherwise the result is unspecified.
+ *
+ * Each lane keeps its K largest values sorted across K vectors. Every loaded vector is merged into them with a chain of
+ * K compare-exchange steps built on @ref max_cmp and @ref select, so the buffer is read once regardless of K. The K
+ * results are then extracted from the K * Elems candidates.
+ *
+ * @code
+ * // Routing of a token to the two experts with the highest score
+ * const auto [scores, experts] = aie::top_k<2, 16>(logits, num_experts);
+ * @endcode
+ *
+ * @tparam K     Number of values to return.
+ * @tparam Elems Number of elements processed per iteration.
+ *
+ * @param in Input buffer. Must meet the alignment requirements of a vector of Elems elements.
+ * @param n  Number of elements. Must be a multiple of Elems, at least K * Elems and at most 32767 * Elems.
+ */
+template <unsigned K, unsigned Elems, ElemBaseType T> requires(K > 0 && !detail::is_complex_v<T>)
+__aie_inline
+std::pair<std::array<T, K>, std::array<unsigned, K>> top_k(const T *in, unsigned n)
+{
+    REQUIRES_MSG(n % Elems == 0 && n / Elems >= K, "Number of elements must be a multiple of the vector size, and at least K vectors");
+    REQUIRES_MSG(n / Elems <= 32767, "Too many elements");
+
+#if !AIE_API_DISABLE_ALIGNMENT_ASSERTIONS
+    RUNTIME_ASSERT_NO_ASSUME(detail::check_vector_alignment<Elems>(in), "Insufficient input alignment");
+#endif
+
+    detail::top_k<K, T, Elems> state;
+
+    // The first K vectors fill the rows, which avoids padding values that could be mistaken for input values
+    Utils::unroll_times<K>([&](auto row) __aie_inline {
+        state.template insert<row, true>(load_v<Elems>(in), broadcast<int16, Elems>(int16(row)));
+        in += Elems;
+    });
+
+    for (unsigned i = K; i < n / Elems; ++i)
+        chess_prepare_for_pipelining
+    {
+        state.template insert<K, false>(load_v<Elems>(in), broadcast<int16, Elems>(int16(i)));
+        in += Elems;
+    }
+
+    return state.template extract<K>();
+}
+
+} // namespace aie
+
+#endif